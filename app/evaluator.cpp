@@ -79,7 +79,8 @@ void handle_vec(Parser &p, std::unordered_map<std::string, Value> &symbols) {
     p.expect('=', "expected '=' after vector name");
     auto values = p.parse_vector_literal();
     p.expect_end();
-    Value v{Value::Kind::Vector, make_vector(values), la::Matrix(0, 0)};
+    Value v{Value::Kind::Vector, la::SharedVector(make_vector(values)),
+            la::SharedMatrix()};
     set_symbol(symbols, std::move(name), std::move(v));
 }
 
@@ -88,7 +89,8 @@ void handle_mat(Parser &p, std::unordered_map<std::string, Value> &symbols) {
     p.expect('=', "expected '=' after matrix name");
     auto rows = p.parse_matrix_literal();
     p.expect_end();
-    Value m{Value::Kind::Matrix, la::Vector(), make_matrix(rows)};
+    Value m{Value::Kind::Matrix, la::SharedVector(),
+            la::SharedMatrix(make_matrix(rows))};
     set_symbol(symbols, std::move(name), std::move(m));
 }
 
@@ -217,7 +219,7 @@ void handle_in_span(Parser &p,
     }
 
     // Vector form: in_span <b> <v1> <v2> ... <vn>
-    std::vector<la::Vector> spanning_vectors;
+    std::vector<la::SharedVector> spanning_vectors;
     for (const auto &name : spanning_names) {
         if (!symbols.count(name)) {
             throw std::runtime_error("unknown symbol: " + name);
@@ -254,7 +256,7 @@ void handle_lin_indep(Parser &p,
 
     if (symbols.at(first).kind == Value::Kind::Matrix) {
         // Matrix form: lin_indep <M1> <M2> ... <Mn>
-        std::vector<la::Matrix> matrices;
+        std::vector<la::SharedMatrix> matrices;
         for (const auto &name : names) {
             if (!symbols.count(name)) {
                 throw std::runtime_error("unknown symbol: " + name);
@@ -272,7 +274,7 @@ void handle_lin_indep(Parser &p,
     }
 
     // Vector form: lin_indep <v1> <v2> ... <vn>
-    std::vector<la::Vector> vectors;
+    std::vector<la::SharedVector> vectors;
     for (const auto &name : names) {
         if (!symbols.count(name)) {
             throw std::runtime_error("unknown symbol: " + name);
@@ -1,11 +1,13 @@
 #ifndef LA_CALC_VALUE_HPP
 #define LA_CALC_VALUE_HPP
 
-#include "la/matrix.hpp"
-#include "la/vector.hpp"
+#include "la/shared.hpp"
 
 /**
  * @brief Typed value stored in the REPL symbol table.
+ *
+ * Payloads are copy-on-write handles, so copying a Value (or collecting
+ * arguments for a command) does not deep-copy the matrix or vector.
  */
 struct Value {
     /** @brief Indicates which payload is valid. */
@@ -13,9 +15,9 @@ struct Value {
     /** @brief Discriminant describing which payload is active. */
     Kind kind;
     /** @brief Vector payload when kind == Kind::Vector. */
-    la::Vector vec;
+    la::SharedVector vec;
     /** @brief Matrix payload when kind == Kind::Matrix. */
-    la::Matrix mat;
+    la::SharedMatrix mat;
 };
 
 #endif
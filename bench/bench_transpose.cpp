@@ -0,0 +1,84 @@
+// Transpose benchmark over power-of-two shapes.
+//
+// Power-of-two row lengths map every element of a column to the same cache
+// set, which is the worst case for the old row-copy + strided set_col
+// transpose.  That baseline is kept here for comparison.
+
+#include "la/matrix.hpp"
+#include "la/matrix_transforms.hpp"
+#include <chrono>
+#include <cstdio>
+
+namespace {
+// Results are written here so the timed work cannot be optimised away.
+volatile double g_sink;
+
+la::Matrix row_copy_transpose(const la::Matrix &A) {
+    la::Matrix T(A.cols(), A.rows());
+    for (std::size_t i = 0; i < A.rows(); i++) {
+        T.set_col(i, A.row(i));
+    }
+    return T;
+}
+
+la::Matrix sample_matrix(std::size_t m, std::size_t n) {
+    la::Matrix A(m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            A(i, j) = static_cast<double>(i * n + j);
+        }
+    }
+    return A;
+}
+
+// Best of a few runs, in milliseconds.
+template <typename F> double time_ms(F f) {
+    double best = 0.0;
+    for (int run = 0; run < 3; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto stop = std::chrono::steady_clock::now();
+        double ms =
+            std::chrono::duration<double, std::milli>(stop - start).count();
+        if (run == 0 || ms < best)
+            best = ms;
+    }
+    return best;
+}
+} // namespace
+
+int main() {
+    const std::size_t shapes[][2] = {{256, 256},   {512, 512},
+                                     {1024, 1024}, {2048, 2048},
+                                     {512, 4096},  {4096, 512}};
+
+    std::printf("%-11s %12s %12s %12s %12s\n", "shape", "row-copy", "blocked",
+                "in-place", "parallel");
+    for (const auto &shape : shapes) {
+        const std::size_t m = shape[0];
+        const std::size_t n = shape[1];
+        la::Matrix A = sample_matrix(m, n);
+
+        double baseline =
+            time_ms([&] { g_sink = row_copy_transpose(A)(0, 1); });
+        double blocked = time_ms([&] { g_sink = la::transpose(A)(0, 1); });
+        double parallel =
+            time_ms([&] { g_sink = la::transpose_parallel(A)(0, 1); });
+
+        char inplace_text[16] = "-";
+        if (m == n) {
+            la::Matrix B = A;
+            double inplace = time_ms([&] {
+                la::transpose_inplace(B);
+                g_sink = B(0, 1);
+            });
+            std::snprintf(inplace_text, sizeof inplace_text, "%.2f", inplace);
+        }
+
+        char shape_text[16];
+        std::snprintf(shape_text, sizeof shape_text, "%zux%zu", m, n);
+        std::printf("%-11s %12.2f %12.2f %12s %12.2f\n", shape_text,
+                    baseline, blocked, inplace_text, parallel);
+    }
+    return 0;
+}
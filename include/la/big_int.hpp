@@ -0,0 +1,124 @@
+#ifndef LA_BIG_INT_HPP
+#define LA_BIG_INT_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace la {
+/**
+ * A signed integer of unbounded size.
+ *
+ * Sign and magnitude, the magnitude in base 2^32 limbs with the least
+ * significant limb first and no leading zero limbs, so zero has no limbs.
+ * Division truncates toward zero like the built-in integers.
+ */
+class BigInt {
+  public:
+    /** @return zero */
+    BigInt() = default;
+
+    /** @return the value v */
+    BigInt(long long v); // NOLINT: implicit like the built-in integers
+
+    /**
+     * @return the value of a decimal string with an optional leading sign
+     * @throws std::invalid_argument if s is not a decimal integer
+     */
+    explicit BigInt(const std::string &s);
+
+    /** @return -1, 0 or +1 */
+    int sign() const noexcept { return mag_.empty() ? 0 : (neg_ ? -1 : 1); }
+
+    /** @return true if the value is zero */
+    bool is_zero() const noexcept { return mag_.empty(); }
+
+    /** @return the number of significant bits of |*this|, 0 for zero */
+    std::size_t bit_length() const noexcept;
+
+    /** @return true if the value fits in a long long */
+    bool fits_int64() const noexcept;
+
+    /**
+     * @return the value as a long long
+     * @throws std::out_of_range if !fits_int64()
+     */
+    long long to_int64() const;
+
+    /** @return the nearest double (rounded toward zero for huge values) */
+    double to_double() const noexcept;
+
+    /** @return the decimal representation */
+    std::string to_string() const;
+
+    /**
+     * @return the residue of the value modulo m, in [0, m)
+     * @throws std::domain_error if m == 0
+     */
+    std::uint32_t mod(std::uint32_t m) const;
+
+    BigInt operator-() const;
+    BigInt &operator+=(const BigInt &b);
+    BigInt &operator-=(const BigInt &b);
+    BigInt &operator*=(const BigInt &b);
+
+    /** @throws std::domain_error on division by zero */
+    BigInt &operator/=(const BigInt &b);
+
+    /** @throws std::domain_error on division by zero */
+    BigInt &operator%=(const BigInt &b);
+
+    /**
+     * @brief Truncating division, a = q b + r with |r| < |b| and r having
+     * the sign of a.
+     * @throws std::domain_error if b is zero
+     */
+    static void divmod(const BigInt &a, const BigInt &b, BigInt &q,
+                       BigInt &r);
+
+    friend bool operator==(const BigInt &a, const BigInt &b) noexcept {
+        return a.neg_ == b.neg_ && a.mag_ == b.mag_;
+    }
+    friend bool operator<(const BigInt &a, const BigInt &b) noexcept;
+
+  private:
+    using Limbs = std::vector<std::uint32_t>;
+
+    void trim() noexcept;
+
+    bool neg_ = false;
+    Limbs mag_;
+};
+
+inline bool operator!=(const BigInt &a, const BigInt &b) noexcept {
+    return !(a == b);
+}
+inline bool operator>(const BigInt &a, const BigInt &b) noexcept {
+    return b < a;
+}
+inline bool operator<=(const BigInt &a, const BigInt &b) noexcept {
+    return !(b < a);
+}
+inline bool operator>=(const BigInt &a, const BigInt &b) noexcept {
+    return !(a < b);
+}
+
+inline BigInt operator+(BigInt a, const BigInt &b) { return a += b; }
+inline BigInt operator-(BigInt a, const BigInt &b) { return a -= b; }
+inline BigInt operator*(BigInt a, const BigInt &b) { return a *= b; }
+inline BigInt operator/(BigInt a, const BigInt &b) { return a /= b; }
+inline BigInt operator%(BigInt a, const BigInt &b) { return a %= b; }
+
+/** @return |a| */
+BigInt abs(BigInt a);
+
+/** @return the greatest common divisor of |a| and |b|, gcd(0, 0) = 0 */
+BigInt gcd(BigInt a, BigInt b);
+
+inline std::ostream &operator<<(std::ostream &os, const BigInt &a) {
+    return os << a.to_string();
+}
+} // namespace la
+
+#endif // LA_BIG_INT_HPP
@@ -0,0 +1,80 @@
+#ifndef LA_BIT_COUNT_HPP
+#define LA_BIT_COUNT_HPP
+
+#include "la/bit_matrix.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace la {
+/**
+ * Hamming weight, parity and distance over runtime-sized bit buffers.
+ *
+ * Buffers are arrays of 64-bit words, bit j in word j / 64 like BitVector
+ * and the rows of BitMatrix.  An array of records is count blocks of
+ * record_words consecutive words each, e.g. 1, 2 or 8 words for 64-, 128-
+ * or 512-bit records.
+ *
+ * The word counts go through a kernel chosen once at run time: AVX-512
+ * VPOPCNTDQ, eight words per instruction, if the CPU has it, else the
+ * POPCNT instruction, else a portable bit-twiddling count.  Builds for
+ * other targets only have the portable kernel.
+ */
+
+/** The popcount kernels, slowest first. */
+enum class PopcountKernel { Portable, Popcnt, Avx512 };
+
+/** @return the kernel in use */
+PopcountKernel popcount_kernel() noexcept;
+
+/**
+ * @brief Use kernel k from now on, e.g. to compare kernels.
+ * @return false, keeping the current kernel, if the CPU lacks k
+ */
+bool set_popcount_kernel(PopcountKernel k) noexcept;
+
+/** @return the number of one bits in the n words at w */
+std::size_t popcount(const std::uint64_t *w, std::size_t n) noexcept;
+
+/** @return the parity (sum mod 2) of the n words at w */
+bool parity(const std::uint64_t *w, std::size_t n) noexcept;
+
+/** @return the number of bits in which the n words at a and b differ */
+std::size_t hamming_distance(const std::uint64_t *a, const std::uint64_t *b,
+                             std::size_t n) noexcept;
+
+/**
+ * @brief Hamming weight of each of count records of record_words words.
+ * @param weights overwritten with count weights
+ */
+void record_weights(const std::uint64_t *w, std::size_t count,
+                    std::size_t record_words,
+                    std::vector<std::uint32_t> &weights);
+
+/**
+ * @brief Parity bit of each of count records of record_words words.
+ * @param parities resized to count; bit i is the parity of record i
+ */
+void record_parities(const std::uint64_t *w, std::size_t count,
+                     std::size_t record_words, BitVector &parities);
+
+/**
+ * @brief Hamming distance between every pair of count records.
+ * @param distances overwritten with count * count distances, row-major;
+ * entry (i, j) is the distance between records i and j
+ */
+void pairwise_hamming_distances(const std::uint64_t *w, std::size_t count,
+                                std::size_t record_words,
+                                std::vector<std::uint32_t> &distances);
+
+/** @return the parity of every row of A */
+BitVector row_parities(const BitMatrix &A);
+
+/**
+ * @return the count * count Hamming distances between the rows of A,
+ * row-major
+ */
+std::vector<std::uint32_t> pairwise_hamming_distances(const BitMatrix &A);
+} // namespace la
+
+#endif // LA_BIT_COUNT_HPP
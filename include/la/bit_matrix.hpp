@@ -0,0 +1,253 @@
+#ifndef LA_BIT_MATRIX_HPP
+#define LA_BIT_MATRIX_HPP
+
+#include "la/pivot_info.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace la {
+/** @return the number of one bits in w */
+inline int popcount(std::uint64_t w) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(w);
+#else
+    int n = 0;
+    for (; w; w &= w - 1) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/**
+ * A vector over GF(2), packed 64 bits to a word.
+ *
+ * Bit j lives in word j / 64 at position j % 64.  Bits past size() in the
+ * last word are always zero, so whole words can be compared, XORed and
+ * counted directly.
+ */
+class BitVector {
+  public:
+    /** @return empty vector */
+    BitVector() = default;
+
+    /** @return zero vector of n bits */
+    explicit BitVector(std::size_t n) : n_(n), words_((n + 63) / 64) {}
+
+    /** @return vector from 0/1 values, nonzero meaning 1 */
+    BitVector(std::initializer_list<int> bits);
+
+    /** @return the number of bits */
+    std::size_t size() const noexcept { return n_; }
+
+    /** @return bit j, without range check */
+    bool operator[](std::size_t j) const noexcept {
+        return (words_[j / 64] >> (j % 64)) & 1u;
+    }
+
+    /** @brief Set bit j to value, without range check. */
+    void set(std::size_t j, bool value = true) noexcept {
+        std::uint64_t &w = words_[j / 64];
+        const std::uint64_t mask = std::uint64_t{1} << (j % 64);
+        w = value ? w | mask : w & ~mask;
+    }
+
+    /** @brief Flip bit j, without range check. */
+    void flip(std::size_t j) noexcept {
+        words_[j / 64] ^= std::uint64_t{1} << (j % 64);
+    }
+
+    /** @return the number of one bits (Hamming weight) */
+    std::size_t weight() const noexcept;
+
+    /** @return true if the number of one bits is odd */
+    bool parity() const noexcept { return weight() % 2 != 0; }
+
+    /** @return the packed words */
+    const std::uint64_t *data() const noexcept { return words_.data(); }
+
+    /** @copydoc data */
+    std::uint64_t *data() noexcept { return words_.data(); }
+
+    /** @return the number of packed words */
+    std::size_t words() const noexcept { return words_.size(); }
+
+    /**
+     * @brief *this ^= other, i.e. addition over GF(2)
+     * @throws std::invalid_argument if the sizes differ
+     */
+    BitVector &operator^=(const BitVector &other);
+
+    friend bool operator==(const BitVector &a, const BitVector &b) {
+        return a.n_ == b.n_ && a.words_ == b.words_;
+    }
+    friend bool operator!=(const BitVector &a, const BitVector &b) {
+        return !(a == b);
+    }
+
+  private:
+    std::size_t n_ = 0;
+    std::vector<std::uint64_t> words_;
+};
+
+/**
+ * A matrix over GF(2) with each row packed into 64-bit words.
+ *
+ * Row operations work a word at a time: adding one row to another is an
+ * XOR of ceil(cols / 64) words.  Bits past cols() are always zero.
+ */
+class BitMatrix {
+  public:
+    /** @return empty 0x0 matrix */
+    BitMatrix() = default;
+
+    /** @return zero matrix of the given shape */
+    BitMatrix(std::size_t rows, std::size_t cols)
+        : rows_(rows), cols_(cols), stride_((cols + 63) / 64),
+          data_(rows * stride_) {}
+
+    /**
+     * @return matrix from row-major 0/1 values, nonzero meaning 1
+     * @throws std::invalid_argument if bits.size() != rows * cols
+     */
+    BitMatrix(std::size_t rows, std::size_t cols,
+              std::initializer_list<int> bits);
+
+    /** @return rows */
+    std::size_t rows() const noexcept { return rows_; }
+
+    /** @return columns */
+    std::size_t cols() const noexcept { return cols_; }
+
+    /** @return the number of words per row */
+    std::size_t stride() const noexcept { return stride_; }
+
+    /** @return bit (i, j), without range check */
+    bool operator()(std::size_t i, std::size_t j) const noexcept {
+        return (row_data(i)[j / 64] >> (j % 64)) & 1u;
+    }
+
+    /**
+     * @return bit (i, j)
+     * @throws std::out_of_range if (i, j) is outside the matrix
+     */
+    bool at(std::size_t i, std::size_t j) const;
+
+    /** @brief Set bit (i, j) to value, without range check. */
+    void set(std::size_t i, std::size_t j, bool value = true) noexcept {
+        std::uint64_t &w = row_data(i)[j / 64];
+        const std::uint64_t mask = std::uint64_t{1} << (j % 64);
+        w = value ? w | mask : w & ~mask;
+    }
+
+    /** @brief Flip bit (i, j), without range check. */
+    void flip(std::size_t i, std::size_t j) noexcept {
+        row_data(i)[j / 64] ^= std::uint64_t{1} << (j % 64);
+    }
+
+    /** @return the packed words of row i, without range check */
+    std::uint64_t *row_data(std::size_t i) noexcept {
+        return data_.data() + i * stride_;
+    }
+
+    /** @copydoc row_data */
+    const std::uint64_t *row_data(std::size_t i) const noexcept {
+        return data_.data() + i * stride_;
+    }
+
+    /** @return row i as a vector */
+    BitVector row(std::size_t i) const;
+
+    /** @brief Row dst += row src over GF(2), without range check. */
+    void xor_rows(std::size_t dst, std::size_t src) noexcept {
+        std::uint64_t *d = row_data(dst);
+        const std::uint64_t *s = row_data(src);
+        for (std::size_t w = 0; w < stride_; ++w) {
+            d[w] ^= s[w];
+        }
+    }
+
+    /** @brief Exchange rows a and b, without range check. */
+    void exchange_rows(std::size_t a, std::size_t b) noexcept;
+
+    /** @return the number of one bits in row i */
+    std::size_t row_weight(std::size_t i) const noexcept;
+
+    /** @return true if row i has an odd number of one bits */
+    bool row_parity(std::size_t i) const noexcept {
+        return row_weight(i) % 2 != 0;
+    }
+
+    friend bool operator==(const BitMatrix &a, const BitMatrix &b) {
+        return a.rows_ == b.rows_ && a.cols_ == b.cols_ && a.data_ == b.data_;
+    }
+    friend bool operator!=(const BitMatrix &a, const BitMatrix &b) {
+        return !(a == b);
+    }
+
+  private:
+    std::size_t rows_ = 0;
+    std::size_t cols_ = 0;
+    std::size_t stride_ = 0;
+    std::vector<std::uint64_t> data_;
+};
+
+/** @return the n x n identity matrix over GF(2) */
+BitMatrix bit_identity(std::size_t n);
+
+/** @return the transpose of A */
+BitMatrix transpose(const BitMatrix &A);
+
+/**
+ * @brief matrix vector product over GF(2)
+ *
+ * Each result bit is the parity of a row ANDed with x, so for a
+ * parity-check matrix H, H * x is the syndrome of x.
+ *
+ * @return A x
+ * @throws std::invalid_argument if x.size() != A.cols()
+ */
+BitVector operator*(const BitMatrix &A, const BitVector &x);
+
+/**
+ * @brief matrix product over GF(2)
+ * @return A B
+ * @throws std::invalid_argument if A.cols() != B.rows()
+ */
+BitMatrix operator*(const BitMatrix &A, const BitMatrix &B);
+
+/**
+ * @brief reduce A to reduced row echelon form over GF(2) in place
+ *
+ * Uses the method of four Russians (M4RI): pivots are found in strips of
+ * up to eight columns, all 2^k sums of the strip's pivot rows are
+ * tabulated, and every other row is then cleared of the whole strip with a
+ * single table lookup and one row XOR.
+ *
+ * @param A the matrix to reduce, overwritten with its RREF
+ * @return the pivot columns of the RREF and the remaining free columns
+ */
+PivotInfo rref_inplace(BitMatrix &A);
+
+/** @return the rank of A over GF(2) */
+std::size_t rank(const BitMatrix &A);
+
+/**
+ * @brief solve A x = b over GF(2)
+ * @param x overwritten with a solution, all free variables zero, if one
+ * exists; left unchanged otherwise
+ * @return false if the system has no solution
+ * @throws std::invalid_argument if b.size() != A.rows()
+ */
+bool solve(const BitMatrix &A, const BitVector &b, BitVector &x);
+
+/**
+ * @return a basis of the null space {x : A x = 0}, one basis vector per
+ * row (nullity x A.cols())
+ */
+BitMatrix null_space(const BitMatrix &A);
+} // namespace la
+
+#endif // LA_BIT_MATRIX_HPP
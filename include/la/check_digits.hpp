@@ -0,0 +1,341 @@
+#ifndef LA_CHECK_DIGITS_HPP
+#define LA_CHECK_DIGITS_HPP
+
+#include "la/bit_matrix.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace la {
+/**
+ * Check-digit schemes for fixed-width ASCII codes.
+ *
+ * A scheme is a type with
+ *  - `static constexpr std::size_t length`, the characters per code
+ *    including the check characters;
+ *  - `static bool valid(const char *code) noexcept`;
+ *  - `static bool complete(char *code) noexcept`, which writes the check
+ *    characters from the others and returns false, leaving the code
+ *    unchanged, if one of them is outside the scheme's alphabet.
+ *
+ * Weights, moduli and code lengths are template parameters, so the loops
+ * over the characters of a code have constant trip counts and constant
+ * weights and unroll into straight-line code.  Characters are tested
+ * without branches.  All schemes share the bulk functions
+ * find_code_errors() and complete_codes().
+ */
+
+namespace detail {
+// Element i of the pack W..., for weights known at compile time.
+template <unsigned First, unsigned... Rest> struct WeightPack {
+    static constexpr unsigned at(std::size_t i) {
+        return i == 0 ? First : WeightPack<Rest...>::at(i - 1);
+    }
+};
+
+template <unsigned Last> struct WeightPack<Last> {
+    static constexpr unsigned at(std::size_t) { return Last; }
+};
+
+// Value of an ASCII digit; any other character maps above 9.
+inline unsigned ascii_digit(char c) noexcept {
+    return static_cast<unsigned char>(c) - static_cast<unsigned>('0');
+}
+
+// Value of an IBAN character: 0-9 for digits, 10-35 for A-Z; anything
+// else maps above 35.
+inline unsigned ascii_alnum(char c) noexcept {
+    const unsigned d = ascii_digit(c);
+    const unsigned l = static_cast<unsigned char>(c) -
+                       static_cast<unsigned>('A') + 10u;
+    return d <= 9 ? d : (l >= 10 ? l : 36u);
+}
+
+extern const unsigned char kVerhoeffMul[10][10];
+extern const unsigned char kVerhoeffPerm[8][10];
+extern const unsigned char kVerhoeffInv[10];
+
+void check_stride(std::size_t stride, std::size_t length);
+
+// Overwrite indices with the positions of the set bits of bits, ascending.
+std::size_t set_bit_indices(const BitVector &bits,
+                            std::vector<std::size_t> &indices);
+} // namespace detail
+
+/**
+ * Weighted sum codes: sum of weight(p) * digit(p) == 0 (mod Modulus).
+ *
+ * The weights W... repeat from the first character, and the check
+ * character, the last one, must have weight 1.  For Modulus 11 the check
+ * character may be X (or x), meaning 10.
+ */
+template <std::size_t Length, unsigned Modulus, unsigned... W>
+struct WeightedCheck {
+    static constexpr std::size_t length = Length;
+
+    /** @return the weight of position p */
+    static constexpr unsigned weight(std::size_t p) {
+        return detail::WeightPack<W...>::at(p % sizeof...(W));
+    }
+
+    static_assert(Length > 1, "WeightedCheck: codes need a payload");
+    static_assert(detail::WeightPack<W...>::at((Length - 1) %
+                                               sizeof...(W)) == 1,
+                  "WeightedCheck: the check character must have weight 1");
+
+    /** @return the weighted sum of the first n characters of code */
+    static unsigned sum(const char *code, std::size_t n,
+                        unsigned &bad) noexcept {
+        unsigned s = 0;
+        for (std::size_t p = 0; p < n; ++p) {
+            const unsigned d = detail::ascii_digit(code[p]);
+            bad |= d > 9;
+            s += weight(p) * d;
+        }
+        return s;
+    }
+
+    static bool valid(const char *code) noexcept {
+        unsigned bad = 0;
+        const unsigned s = sum(code, Length - 1, bad);
+        const char last = code[Length - 1];
+        const bool ten = Modulus == 11 && (last == 'X' || last == 'x');
+        const unsigned d = detail::ascii_digit(last);
+        bad |= (d > 9) & !ten;
+        return !bad & ((s + (ten ? 10u : d)) % Modulus == 0);
+    }
+
+    static bool complete(char *code) noexcept {
+        unsigned bad = 0;
+        const unsigned s = sum(code, Length - 1, bad);
+        if (bad)
+            return false;
+        const unsigned c = (Modulus - s % Modulus) % Modulus;
+        code[Length - 1] = c == 10 ? 'X' : static_cast<char>('0' + c);
+        return true;
+    }
+};
+
+template <std::size_t Length, unsigned Modulus, unsigned... W>
+constexpr std::size_t WeightedCheck<Length, Modulus, W...>::length;
+
+/** UPC-A: 12 digits, weights 3, 1, ..., modulus 10. */
+using UpcA = WeightedCheck<12, 10, 3, 1>;
+
+/** EAN-13: 13 digits, weights 1, 3, ..., modulus 10. */
+using Ean13 = WeightedCheck<13, 10, 1, 3>;
+
+/** ISBN-13 is an EAN-13 code. */
+using Isbn13 = Ean13;
+
+/** ISBN-10: 10 characters, weights 10, 9, ..., 1, modulus 11. */
+using Isbn10 = WeightedCheck<10, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1>;
+
+/**
+ * Luhn (mod 10) codes of Length digits, check digit last.  Counting from
+ * the check digit, every second digit is doubled and the digits of the
+ * product are added.
+ */
+template <std::size_t Length> struct Luhn {
+    static constexpr std::size_t length = Length;
+
+    static_assert(Length > 1, "Luhn: codes need a payload");
+
+    /**
+     * @return the Luhn sum of the first n characters of code, for a code
+     * whose check digit is at position last
+     */
+    static unsigned sum(const char *code, std::size_t n, std::size_t last,
+                        unsigned &bad) noexcept {
+        unsigned s = 0;
+        for (std::size_t p = 0; p < n; ++p) {
+            const unsigned d = detail::ascii_digit(code[p]);
+            bad |= d > 9;
+            const unsigned twice = 2 * d - 9 * (d > 4);
+            s += (last - p) % 2 == 1 ? twice : d;
+        }
+        return s;
+    }
+
+    static bool valid(const char *code) noexcept {
+        unsigned bad = 0;
+        const unsigned s = sum(code, Length, Length - 1, bad);
+        return !bad & (s % 10 == 0);
+    }
+
+    static bool complete(char *code) noexcept {
+        unsigned bad = 0;
+        const unsigned s = sum(code, Length - 1, Length - 1, bad);
+        if (bad)
+            return false;
+        code[Length - 1] = static_cast<char>('0' + (10 - s % 10) % 10);
+        return true;
+    }
+};
+
+template <std::size_t Length> constexpr std::size_t Luhn<Length>::length;
+
+/**
+ * Verhoeff codes of Length digits, check digit last.  Detects every
+ * single-digit error and every transposition of adjacent digits.
+ */
+template <std::size_t Length> struct Verhoeff {
+    static constexpr std::size_t length = Length;
+
+    static_assert(Length > 1, "Verhoeff: codes need a payload");
+
+    /**
+     * @return the Verhoeff state of the first n characters of code, read
+     * from the right; the i-th of them takes permutation (shift + i) % 8
+     */
+    static unsigned state(const char *code, std::size_t n, std::size_t shift,
+                          unsigned &bad) noexcept {
+        unsigned c = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const unsigned d = detail::ascii_digit(code[n - 1 - i]);
+            bad |= d > 9;
+            const unsigned char *perm = detail::kVerhoeffPerm[(shift + i) % 8];
+            c = detail::kVerhoeffMul[c][perm[d > 9 ? 0 : d]];
+        }
+        return c;
+    }
+
+    static bool valid(const char *code) noexcept {
+        unsigned bad = 0;
+        const unsigned c = state(code, Length, 0, bad);
+        return !bad & (c == 0);
+    }
+
+    static bool complete(char *code) noexcept {
+        unsigned bad = 0;
+        const unsigned c = state(code, Length - 1, 1, bad);
+        if (bad)
+            return false;
+        code[Length - 1] =
+            static_cast<char>('0' + detail::kVerhoeffInv[c]);
+        return true;
+    }
+};
+
+template <std::size_t Length> constexpr std::size_t Verhoeff<Length>::length;
+
+/**
+ * IBANs of Length characters (22 for Germany and the UK): country letters,
+ * two check digits, then digits and upper-case letters.  Valid when the
+ * number formed by moving the first four characters to the end, with A-Z
+ * read as 10-35, is 1 modulo 97.
+ */
+template <std::size_t Length> struct Iban {
+    static constexpr std::size_t length = Length;
+
+    static_assert(Length > 4 && Length <= 34, "Iban: length out of range");
+
+    /** @return the rearranged number of code modulo 97 */
+    static unsigned residue(const char *code, unsigned &bad) noexcept {
+        unsigned r = 0;
+        for (std::size_t i = 0; i < Length; ++i) {
+            const unsigned v = detail::ascii_alnum(code[(i + 4) % Length]);
+            bad |= v > 35;
+            r = (r * (v > 9 ? 100u : 10u) + v) % 97;
+        }
+        const unsigned c0 = detail::ascii_digit(code[2]);
+        const unsigned c1 = detail::ascii_digit(code[3]);
+        bad |= (c0 > 9) | (c1 > 9);
+        return r;
+    }
+
+    static bool valid(const char *code) noexcept {
+        unsigned bad = 0;
+        const unsigned r = residue(code, bad);
+        return !bad & (r == 1);
+    }
+
+    static bool complete(char *code) noexcept {
+        const char c0 = code[2], c1 = code[3];
+        code[2] = code[3] = '0';
+        unsigned bad = 0;
+        const unsigned c = 98 - residue(code, bad);
+        if (bad) {
+            code[2] = c0;
+            code[3] = c1;
+            return false;
+        }
+        code[2] = static_cast<char>('0' + c / 10);
+        code[3] = static_cast<char>('0' + c % 10);
+        return true;
+    }
+};
+
+template <std::size_t Length> constexpr std::size_t Iban<Length>::length;
+
+/**
+ * @brief Checks fixed-width ASCII codes of scheme S in bulk.
+ *
+ * Code i is the S::length characters starting at codes + i * stride; what
+ * lies between codes is not read.  No memory is allocated per code.
+ *
+ * @param codes the first character of the first code
+ * @param count the number of codes
+ * @param stride the distance between the starts of consecutive codes
+ * @param failed resized to count; bit i is set when code i is invalid
+ * @return the number of invalid codes
+ * @throws std::invalid_argument if stride < S::length
+ */
+template <typename S>
+std::size_t find_code_errors(const char *codes, std::size_t count,
+                             std::size_t stride, BitVector &failed) {
+    detail::check_stride(stride, S::length);
+    failed = BitVector(count);
+    std::uint64_t *out = failed.data();
+    std::size_t total = 0;
+    for (std::size_t base = 0; base < count; base += 64) {
+        const std::size_t end = std::min(count, base + 64);
+        std::uint64_t word = 0;
+        for (std::size_t i = base; i < end; ++i) {
+            const bool ok = S::valid(codes + i * stride);
+            word |= std::uint64_t{!ok} << (i - base);
+        }
+        out[base / 64] = word;
+        total += static_cast<std::size_t>(popcount(word));
+    }
+    return total;
+}
+
+/**
+ * @brief Checks fixed-width ASCII codes of scheme S in bulk.
+ * @param failures overwritten with the indices of the invalid codes,
+ * ascending
+ * @return the number of invalid codes
+ * @throws std::invalid_argument if stride < S::length
+ */
+template <typename S>
+std::size_t find_code_errors(const char *codes, std::size_t count,
+                             std::size_t stride,
+                             std::vector<std::size_t> &failures) {
+    BitVector failed;
+    find_code_errors<S>(codes, count, stride, failed);
+    return detail::set_bit_indices(failed, failures);
+}
+
+/**
+ * @brief Writes the check characters of fixed-width ASCII codes of scheme
+ * S in place.
+ * @return the number of codes left unchanged because a character is
+ * outside the scheme's alphabet
+ * @throws std::invalid_argument if stride < S::length
+ */
+template <typename S>
+std::size_t complete_codes(char *codes, std::size_t count,
+                           std::size_t stride) {
+    detail::check_stride(stride, S::length);
+    std::size_t skipped = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        skipped += !S::complete(codes + i * stride);
+    }
+    return skipped;
+}
+} // namespace la
+
+#endif // LA_CHECK_DIGITS_HPP
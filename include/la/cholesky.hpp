@@ -0,0 +1,128 @@
+#ifndef LA_CHOLESKY_HPP
+#define LA_CHOLESKY_HPP
+
+#include "la/matrix.hpp"
+#include "la/symmetric_matrix.hpp"
+#include "la/triangular_matrix.hpp"
+#include "la/vector.hpp"
+#include "la/workspace.hpp"
+#include <cstddef>
+
+namespace la {
+/**
+ * Cholesky factorization A = L L^T of a symmetric positive definite matrix.
+ *
+ * L is kept as a packed lower TriangularMatrix.  Symmetric rank-one changes
+ * A +- x x^T are applied to L directly in O(n^2), so a rank-k change costs
+ * O(k n^2) instead of a new O(n^3) factorization.  A downdate that loses
+ * too much accuracy is redone by refactoring the changed matrix.
+ */
+class Cholesky {
+  public:
+    /** @return factorization of the empty 0x0 matrix */
+    Cholesky() = default;
+
+    /**
+     * @return factorization of A
+     * @throws std::domain_error if A is not positive definite
+     */
+    explicit Cholesky(const SymmetricMatrix &A);
+
+    /**
+     * @return factorization of A, reading only its upper triangle
+     * @throws std::invalid_argument if A is not square
+     * @throws std::domain_error if A is not positive definite
+     */
+    explicit Cholesky(const Matrix &A);
+
+    /** @return the number of rows (and columns) of A */
+    std::size_t size() const noexcept { return a_.rows(); }
+
+    /** @return the current matrix A, including all updates */
+    const SymmetricMatrix &matrix() const noexcept { return a_; }
+
+    /** @return the lower triangular factor L */
+    const TriangularMatrix &factor() const noexcept { return l_; }
+
+    /**
+     * @return x with A x = b
+     * @throws std::invalid_argument if b.size() != size()
+     */
+    Vector solve(const Vector &b) const;
+
+    /**
+     * @return X with A X = B, one column per right-hand side
+     * @throws std::invalid_argument if B.rows() != size()
+     */
+    Matrix solve(const Matrix &B) const;
+
+    /**
+     * @brief Solve A x = b into x using scratch memory from ws.
+     *
+     * Makes no heap allocations once ws and x have seen a system this size.
+     *
+     * @throws std::invalid_argument if b.size() != size()
+     */
+    void solve(const Vector &b, Vector &x, Workspace &ws) const;
+
+    /**
+     * @brief Solve A X = B into X, reusing the buffer of X.
+     * @throws std::invalid_argument if B.rows() != size()
+     */
+    void solve(const Matrix &B, Matrix &X, Workspace &ws) const;
+
+    /** @return det(A), the squared product of the diagonal of L */
+    double determinant() const noexcept;
+
+    /**
+     * @brief Replace A by A + x x^T.
+     * @throws std::invalid_argument if x.size() != size()
+     */
+    void update(const Vector &x);
+
+    /**
+     * @brief Replace A by A + X X^T, one rank-one update per column of X.
+     * @throws std::invalid_argument if X.rows() != size()
+     */
+    void update(const Matrix &X);
+
+    /**
+     * @brief Replace A by A + X X^T using scratch memory from ws.
+     * @throws std::invalid_argument if X.rows() != size()
+     */
+    void update(const Matrix &X, Workspace &ws);
+
+    /**
+     * @brief Replace A by A - x x^T.
+     * @throws std::invalid_argument if x.size() != size()
+     * @throws std::domain_error if A - x x^T is not positive definite; A is
+     * left unchanged and L is its factor again
+     */
+    void downdate(const Vector &x);
+
+    /**
+     * @brief Replace A by A - X X^T, one rank-one downdate per column of X.
+     * @throws std::invalid_argument if X.rows() != size()
+     * @throws std::domain_error if A - X X^T is not positive definite; A is
+     * left unchanged and L is its factor again
+     */
+    void downdate(const Matrix &X);
+
+    /**
+     * @brief Replace A by A - X X^T using scratch memory from ws.
+     *
+     * L is downdated in place, so this makes no heap allocations unless the
+     * downdate loses too much accuracy and A - X X^T has to be refactored.
+     *
+     * @throws std::invalid_argument if X.rows() != size()
+     * @throws std::domain_error as downdate(X)
+     */
+    void downdate(const Matrix &X, Workspace &ws);
+
+  private:
+    SymmetricMatrix a_; // current A
+    TriangularMatrix l_{0, Triangle::Lower};
+};
+} // namespace la
+
+#endif // LA_CHOLESKY_HPP
@@ -2,6 +2,7 @@
 #define LA_DETERMINANT_HPP
 
 #include "matrix.hpp"
+#include "workspace.hpp"
 
 namespace la {
 
@@ -17,6 +18,17 @@ namespace la {
  * matrix
  */
 double determinant(const Matrix &A);
+
+/**
+ * @brief calculate the determinant of an n x n matrix by elimination
+ *
+ * Gaussian elimination with partial pivoting on a scratch copy of A taken
+ * from ws, so repeated calls with the same workspace do not allocate.
+ *
+ * @return the determinant of A, 1 for a 0x0 matrix
+ * @throws std::domain_error if A is not a square matrix
+ */
+double determinant(const Matrix &A, Workspace &ws);
 } // namespace la
 
 #endif // LA_DETERMINANT_HPP
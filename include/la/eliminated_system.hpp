@@ -23,6 +23,50 @@ struct EliminatedSystem {
     bool inconsistent; ///< True if the system is inconsistent
 };
 
+/**
+ * Metadata from eliminating an augmented matrix in place.
+ *
+ * Same fields as EliminatedSystem, without the reduced matrix, which stays
+ * in the caller's buffer.
+ */
+struct EliminationInfo {
+    PivotInfo pivots;  ///< Pivot and free columns among the n variables
+    bool inconsistent; ///< True if the system is inconsistent
+};
+
+/**
+ * @brief Eliminate an augmented system [A | b] in place
+ * @param Ab augmented matrix with n+1 columns, overwritten with its REF
+ * @return pivot information and consistency of the system
+ * @throws std::invalid_argument if Ab has no columns
+ */
+EliminationInfo eliminate_system_inplace(Matrix &Ab);
+
+/**
+ * @brief Eliminate [A | b] in place, reusing the buffers of pivots
+ * @param Ab augmented matrix with n+1 columns, overwritten with its REF
+ * @param pivots overwritten with the pivot and free columns among the n
+ * variables
+ * @return true if the system is inconsistent
+ * @throws std::invalid_argument if Ab has no columns
+ */
+bool eliminate_system_inplace(Matrix &Ab, PivotInfo &pivots);
+
+/**
+ * @brief Check one right-hand side of an eliminated system for consistency
+ *
+ * Works for an augmented REF [A | b] (B = the whole matrix, col = its last
+ * column) as well as for right-hand sides carried separately by
+ * ref_inplace(A, B, pivots).
+ *
+ * @param B right-hand sides in the row order of the REF
+ * @param col the right-hand side column to check
+ * @param pivots pivot columns of the coefficient part
+ * @return true if that system has no solution
+ */
+bool is_inconsistent(const Matrix &B, std::size_t col,
+                     const PivotInfo &pivots);
+
 /**
  * @brief Eliminate a linear system
  * @param A coefficient matrix
@@ -0,0 +1,140 @@
+#ifndef LA_EXACT_HPP
+#define LA_EXACT_HPP
+
+#include "la/big_int.hpp"
+#include "la/linear_system.hpp"
+#include "la/matrix.hpp"
+#include "la/pivot_info.hpp"
+#include "la/vector.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace la {
+/**
+ * Exact results for matrices whose entries are integers.
+ *
+ * Instead of eliminating over the rationals, where the numbers grow with
+ * every step, the matrix is reduced modulo several 31-bit primes and the
+ * results are combined with the Chinese remainder theorem.  Enough primes
+ * are used that their product exceeds the Hadamard bound on every minor,
+ * so the answers are proven, not estimated; no tolerance is involved.
+ * Each prime is an independent channel with a tight integer inner loop,
+ * and the channels run on n_threads threads (0 for
+ * std::thread::hardware_concurrency).
+ *
+ * The entries must be integers of magnitude at most 2^53, so they are
+ * exactly representable as double.
+ */
+
+/**
+ * A rational solution x = numerators / denominator of A x = b.
+ *
+ * Holds the particular solution with every free variable zero, over a
+ * common positive denominator.
+ */
+struct ExactSolution {
+    SolutionKind kind;
+
+    // Defined iff kind != SolutionKind::None
+    std::vector<BigInt> numerators;
+    BigInt denominator;
+
+    /** @return the solution rounded to double */
+    Vector to_vector() const;
+};
+
+/**
+ * @return the rank of A
+ * @throws std::invalid_argument if an entry of A is not an integer
+ */
+std::size_t exact_rank(const Matrix &A, unsigned n_threads = 0);
+
+/**
+ * @return det(A)
+ * @throws std::invalid_argument if A is not square or an entry is not an
+ * integer
+ */
+BigInt exact_determinant(const Matrix &A, unsigned n_threads = 0);
+
+/**
+ * @return whether A x = b has no, one or infinitely many solutions
+ * @throws std::invalid_argument if b.size() != A.rows() or an entry is not
+ * an integer
+ */
+SolutionKind exact_n_solutions(const Matrix &A, const Vector &b,
+                               unsigned n_threads = 0);
+
+/**
+ * @return true if b is a linear combination of the columns of A
+ * @throws std::invalid_argument if b.size() != A.rows() or an entry is not
+ * an integer
+ */
+bool exact_is_in_span(const Matrix &A, const Vector &b,
+                      unsigned n_threads = 0);
+
+/**
+ * @brief solve A x = b over the rationals
+ *
+ * The solution is found modulo each prime and recovered by rational
+ * reconstruction, then checked against A x = b in exact arithmetic.
+ *
+ * @return the solution structure; for kind == None the numerators are empty
+ * @throws std::invalid_argument if b.size() != A.rows() or an entry is not
+ * an integer
+ */
+ExactSolution exact_solve(const Matrix &A, const Vector &b,
+                          unsigned n_threads = 0);
+
+/**
+ * A fraction-free row echelon form of an integer matrix.
+ *
+ * Every entry is an integer, and the pivot in echelon row i is the
+ * determinant of the leading (i+1) x (i+1) minor formed by the first i+1
+ * pivot rows and columns of the row-permuted input.  The last pivot of a
+ * square nonsingular matrix is therefore its determinant up to sign.
+ */
+struct FractionFreeEchelon {
+    std::size_t rows = 0;
+    std::size_t cols = 0;
+    std::vector<BigInt> entries; ///< row-major echelon form
+    PivotInfo pivots;            ///< pivot and free columns
+    int sign = 1;                ///< sign of the row permutation used
+
+    /** @return the entry at i,j without range check */
+    const BigInt &operator()(std::size_t i, std::size_t j) const noexcept {
+        return entries[i * cols + j];
+    }
+
+    /** @return the rank of the input */
+    std::size_t rank() const noexcept { return pivots.pivot_cols.size(); }
+};
+
+/**
+ * @brief reduce an integer matrix to row echelon form without fractions
+ *
+ * Bareiss elimination: each step replaces a(i, j) by
+ * (a(k, k) a(i, j) - a(i, k) a(k, j)) / p with p the previous pivot, a
+ * division that is always exact.  Intermediate values are minors of A and
+ * so stay within the Hadamard bound.  The elimination runs on 64-bit
+ * integers with overflow checks, and starts over with BigInt only when a
+ * value no longer fits.
+ *
+ * @throws std::invalid_argument if an entry of A is not an integer
+ */
+FractionFreeEchelon fraction_free_ref(const Matrix &A);
+
+/**
+ * @brief determinant by Bareiss elimination
+ *
+ * Same 64-bit fast path with a BigInt fallback as fraction_free_ref().
+ * Costs O(n^3) operations on numbers as wide as the determinant; for large
+ * n, exact_determinant() does the same job in word arithmetic.
+ *
+ * @return det(A)
+ * @throws std::invalid_argument if A is not square or an entry is not an
+ * integer
+ */
+BigInt bareiss_determinant(const Matrix &A);
+} // namespace la
+
+#endif // LA_EXACT_HPP
@@ -0,0 +1,32 @@
+#ifndef LA_GRAM_SCHMIDT_HPP
+#define LA_GRAM_SCHMIDT_HPP
+
+#include "la/matrix.hpp"
+#include "la/pivot_info.hpp"
+
+namespace la {
+/**
+ * @brief Replace the columns of A by an orthonormal basis of their span.
+ *
+ * Blocked Gram-Schmidt with reorthogonalisation (CGS2).  Columns are taken
+ * in blocks; each block is projected twice against the basis found so
+ * far, one block-wide product per pass instead of one proj_onto() per pair
+ * of columns.  Then the columns of the block are orthogonalised against
+ * each other, again twice.  A column is dependent when what remains of it
+ * is effectively zero relative to its original norm; it is dropped and the
+ * basis is packed to the left.
+ *
+ * The block products run on n_threads threads, each owning a stripe of
+ * rows of A, so no two threads write to the same row.  Small matrices are
+ * handled on the calling thread.  No memory is allocated per column.
+ *
+ * @param A overwritten: its first r columns hold the orthonormal basis, in
+ * the order of the columns they came from; the other columns are zero
+ * @param n_threads number of threads, 0 for std::thread::hardware_concurrency
+ * @return the original columns that entered the basis (pivot_cols, r of
+ * them) and the dependent ones (free_cols)
+ */
+PivotInfo orthonormalize_columns(Matrix &A, unsigned n_threads = 0);
+} // namespace la
+
+#endif // LA_GRAM_SCHMIDT_HPP
@@ -0,0 +1,92 @@
+#ifndef LA_INCREMENTAL_BASIS_HPP
+#define LA_INCREMENTAL_BASIS_HPP
+
+#include "la/matrix.hpp"
+#include "la/vector.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace la {
+/**
+ * A basis that grows one vector at a time.
+ *
+ * Keeps an orthonormal basis of the span of the vectors added so far.
+ * Each query projects the vector onto the basis twice (classical
+ * Gram-Schmidt with reorthogonalisation, CGS2), which costs O(n r) for
+ * vectors of size n and rank r.  Once the rank reaches n every vector is in
+ * the span, and queries return without any arithmetic.
+ *
+ * A vector counts as dependent when its residual after projection is
+ * effectively zero relative to its own norm.
+ *
+ * Queries reuse internal scratch buffers, so a basis must not be used from
+ * several threads at once.
+ */
+class IncrementalBasis {
+  public:
+    /** @return empty basis for vectors of size dim */
+    explicit IncrementalBasis(std::size_t dim);
+
+    /** @return the size of the vectors */
+    std::size_t dim() const noexcept { return dim_; }
+
+    /** @return the dimension of the span so far */
+    std::size_t rank() const noexcept { return rank_; }
+
+    /** @return true if the basis spans the whole space */
+    bool is_full() const noexcept { return rank_ == dim_; }
+
+    /**
+     * @brief Add v to the basis if it is independent of it.
+     * @return true if v was independent and the rank grew
+     * @throws std::invalid_argument if v.size() != dim()
+     */
+    bool add(const Vector &v);
+
+    /**
+     * @return true if v lies in the span of the vectors added so far
+     * @throws std::invalid_argument if v.size() != dim()
+     */
+    bool contains(const Vector &v) const;
+
+    /**
+     * @return the orthonormal basis, one vector per row (rank() x dim())
+     */
+    Matrix basis() const;
+
+    /** @brief Remove every vector, keeping the allocated storage. */
+    void clear() noexcept { rank_ = 0; }
+
+  private:
+    void check_size(const Vector &v) const;
+
+    // Leaves v minus its projection onto the basis in residual_ and
+    // returns true if that residual is effectively zero.
+    bool project_out(const Vector &v) const;
+
+    std::size_t dim_;
+    std::size_t rank_ = 0;
+    std::vector<double> q_; // orthonormal rows, rank_ x dim_ used
+    mutable std::vector<double> residual_;
+    mutable std::vector<double> coeffs_;
+};
+
+/**
+ * @brief Linear independence test that feeds the vectors to an
+ * IncrementalBasis and stops at the first dependent one.
+ *
+ * Builds no column matrix, and returns false at once when there are more
+ * vectors than dimensions.  A vector counts as dependent by the
+ * IncrementalBasis residual test, which is relative to the vector's own
+ * norm; are_linearly_independent() instead ranks the column matrix with
+ * the elimination pivot tolerance, so the two can differ on nearly
+ * dependent input.
+ *
+ * @param vectors the vectors to check, sizes must be equal
+ * @return true if the vectors are linearly independent
+ * @throws std::invalid_argument if the vector sizes don't match
+ */
+bool are_linearly_independent_incremental(const std::vector<Vector> &vectors);
+} // namespace la
+
+#endif // LA_INCREMENTAL_BASIS_HPP
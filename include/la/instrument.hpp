@@ -0,0 +1,117 @@
+#ifndef LA_INSTRUMENT_HPP
+#define LA_INSTRUMENT_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace la {
+/**
+ * Optional allocation and copy accounting for Matrix and Vector.
+ *
+ * Building with -DLA_INSTRUMENT (`make instrument` does this) routes the
+ * element storage of Matrix and Vector through a counting allocator and
+ * counts their deep copies.  Without the flag the storage is a plain
+ * std::vector<double>, the hooks compile away and every counter reads zero.
+ * The library and its users must be built with the same setting.
+ */
+namespace instrument {
+#ifdef LA_INSTRUMENT
+constexpr bool kEnabled = true;
+#else
+constexpr bool kEnabled = false;
+#endif
+
+/** Running totals of the accounted events. */
+struct Counters {
+    std::size_t allocations = 0;   // element buffers allocated
+    std::size_t bytes = 0;         // bytes requested for those buffers
+    std::size_t matrix_copies = 0; // Matrix copy constructions/assignments
+    std::size_t vector_copies = 0; // Vector copy constructions/assignments
+};
+
+/** @return the counts accumulated between before and after */
+Counters operator-(const Counters &after, const Counters &before) noexcept;
+
+/** @return the totals since program start or the last reset() */
+Counters snapshot() noexcept;
+
+/** @brief Zero every counter. */
+void reset() noexcept;
+
+/**
+ * Counts what happens between its construction and a call to delta(), e.g.
+ * the cost of one public API call:
+ *
+ *     instrument::Scope scope;
+ *     Matrix T = transpose(A);
+ *     assert(scope.delta().allocations == 1);
+ *
+ * The counters are global, so work on other threads is included.
+ */
+class Scope {
+  public:
+    Scope() noexcept : start_(snapshot()) {}
+
+    /** @return the counts accumulated since this scope was opened */
+    Counters delta() const noexcept { return snapshot() - start_; }
+
+  private:
+    Counters start_;
+};
+
+namespace detail {
+enum class Kind { Matrix, Vector };
+
+void record_allocation(std::size_t bytes) noexcept;
+void record_copy(Kind kind) noexcept;
+
+#ifdef LA_INSTRUMENT
+/** std::allocator that reports every allocation to record_allocation(). */
+template <typename T> struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() noexcept = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        record_allocation(n * sizeof(T));
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const CountingAllocator &,
+                           const CountingAllocator &) noexcept {
+        return true;
+    }
+    friend bool operator!=(const CountingAllocator &,
+                           const CountingAllocator &) noexcept {
+        return false;
+    }
+};
+
+/** Member that counts deep copies of its owner; moves are not counted. */
+template <Kind K> struct CopyCounter {
+    CopyCounter() noexcept = default;
+    CopyCounter(const CopyCounter &) noexcept { record_copy(K); }
+    CopyCounter(CopyCounter &&) noexcept = default;
+    CopyCounter &operator=(const CopyCounter &) noexcept {
+        record_copy(K);
+        return *this;
+    }
+    CopyCounter &operator=(CopyCounter &&) noexcept = default;
+};
+
+using Storage = std::vector<double, CountingAllocator<double>>;
+#else
+using Storage = std::vector<double>;
+#endif
+} // namespace detail
+} // namespace instrument
+} // namespace la
+
+#endif // LA_INSTRUMENT_HPP
@@ -0,0 +1,134 @@
+#ifndef LA_LINEAR_CODE_HPP
+#define LA_LINEAR_CODE_HPP
+
+#include "la/bit_matrix.hpp"
+#include "la/pivot_info.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace la {
+/** Outcome of checking one received word. */
+enum class DecodeStatus {
+    Clean,        // zero syndrome, a codeword
+    Corrected,    // a single bit error was found and flipped
+    Uncorrectable // nonzero syndrome that no single bit error explains
+};
+
+/** Counts of a bulk correction, and which rows could not be corrected. */
+struct DecodeSummary {
+    std::size_t clean = 0;
+    std::size_t corrected = 0;
+    std::vector<std::size_t> uncorrectable;
+};
+
+/**
+ * A binary linear [n, k] block code.
+ *
+ * Generalises the single parity bit of parity_bit() to r = n - k parity
+ * checks.  The generator G (k x n) is kept in reduced row echelon form, so
+ * message bit i appears unchanged at the i-th pivot column of the codeword
+ * and each parity bit is the sum of the message bits selected by one
+ * column of G.  The parity-check matrix H (r x n) satisfies G H^T = 0, and
+ * H w is the syndrome of a received word w.
+ *
+ * Encoding and syndromes go a byte at a time through tables of 256
+ * precomputed r-bit sums, so a word costs n / 8 lookups and XORs instead
+ * of n bit operations.  Single-bit errors are corrected through a table
+ * from syndrome to error position.  Because syndromes are held in 32-bit
+ * words and that table has 2^r entries, r is limited to kMaxRedundancy.
+ */
+class LinearCode {
+  public:
+    /** Largest supported number of parity checks n - k. */
+    static constexpr std::size_t kMaxRedundancy = 20;
+
+    /**
+     * @return the code spanned by the rows of G
+     * @throws std::invalid_argument if the rows of G are dependent, G has
+     * no rows, or G.cols() - G.rows() > kMaxRedundancy
+     */
+    explicit LinearCode(const BitMatrix &G);
+
+    /**
+     * @return the [2^r - 1, 2^r - 1 - r] Hamming code, which corrects every
+     * single bit error; parity bits are the last r positions
+     * @throws std::invalid_argument unless 2 <= r <= 12
+     */
+    static LinearCode hamming(unsigned r);
+
+    /** @return n, the codeword length */
+    std::size_t length() const noexcept { return g_.cols(); }
+
+    /** @return k, the message length */
+    std::size_t dimension() const noexcept { return g_.rows(); }
+
+    /** @return r = n - k, the number of parity checks */
+    std::size_t redundancy() const noexcept { return length() - dimension(); }
+
+    /** @return the generator matrix in reduced row echelon form (k x n) */
+    const BitMatrix &generator() const noexcept { return g_; }
+
+    /** @return the parity-check matrix (r x n) */
+    const BitMatrix &parity_check() const noexcept { return h_; }
+
+    /**
+     * @return the codeword of message m, i.e. m G
+     * @throws std::invalid_argument if m.size() != dimension()
+     */
+    BitVector encode(const BitVector &m) const;
+
+    /**
+     * @return one codeword per row of messages
+     * @throws std::invalid_argument if messages.cols() != dimension()
+     */
+    BitMatrix encode(const BitMatrix &messages) const;
+
+    /**
+     * @return the message of a codeword, its bits at the pivot columns
+     * @throws std::invalid_argument if c.size() != length()
+     */
+    BitVector message(const BitVector &c) const;
+
+    /**
+     * @return the syndrome H w, bit t for parity check t
+     * @throws std::invalid_argument if w.size() != length()
+     */
+    std::uint32_t syndrome(const BitVector &w) const;
+
+    /**
+     * @return the syndrome of every row of words
+     * @throws std::invalid_argument if words.cols() != length()
+     */
+    std::vector<std::uint32_t> syndromes(const BitMatrix &words) const;
+
+    /**
+     * @brief Correct a single bit error in w in place.
+     * @return what was found; w is only changed for Corrected
+     * @throws std::invalid_argument if w.size() != length()
+     */
+    DecodeStatus correct(BitVector &w) const;
+
+    /**
+     * @brief Correct a single bit error in every row of words in place.
+     * @return counts per outcome and the uncorrectable rows
+     * @throws std::invalid_argument if words.cols() != length()
+     */
+    DecodeSummary correct(BitMatrix &words) const;
+
+  private:
+    std::uint32_t syndrome_of(const std::uint64_t *w) const noexcept;
+    void encode_into(const std::uint64_t *m, std::uint64_t *c) const noexcept;
+    DecodeStatus correct_words(std::uint64_t *w) const noexcept;
+
+    BitMatrix g_;
+    BitMatrix h_;
+    PivotInfo info_;          // pivot (message) and free (parity) columns
+    bool systematic_ = false; // message bits are the first k columns
+    std::vector<std::uint32_t> parity_table_;   // per message byte
+    std::vector<std::uint32_t> syndrome_table_; // per codeword byte
+    std::vector<std::uint32_t> error_at_;       // syndrome -> position + 1
+};
+} // namespace la
+
+#endif // LA_LINEAR_CODE_HPP
@@ -2,7 +2,9 @@
 #define LINEAR_SYSTEM_HPP
 
 #include "matrix.hpp"
+#include "pivot_info.hpp"
 #include "vector.hpp"
+#include "workspace.hpp"
 
 namespace la {
 enum class SolutionKind {
@@ -17,14 +19,23 @@ struct LinearSystemSolution {
     // Defined iff kind != SolutionKind::None
     Vector particular;
 
-    // Basis for the homogeneous solution space.
-    // - empty if unique solution
-    // - size() == nullity if infinite solutions
-    std::vector<Vector> directions;
+    // Basis for the homogeneous solution space, one column per free
+    // variable (n x nullity).
+    // - no columns if unique solution
+    // - 0x0 if no solution
+    Matrix null_space;
 
     bool has_solution() const { return kind != SolutionKind::None; }
     bool is_unique() const { return kind == SolutionKind::Unique; }
     bool is_infinite() const { return kind == SolutionKind::Infinite; }
+
+    /**
+     * @brief the null space basis as separate vectors, built on demand
+     *
+     * @return one vector per column of null_space; empty if the solution
+     * is unique or there is none
+     */
+    std::vector<Vector> directions() const;
 };
 
 /**
@@ -46,6 +57,56 @@ SolutionKind n_solutions(const Matrix &A, const Vector &b);
  * @throws std::invalid_argument if the size of b does not match rows of A
  */
 LinearSystemSolution solve(const Matrix &A, const Vector &b);
+
+/**
+ * @brief solve the linear systems A|B[:, j] for every column j of B
+ *
+ * A is eliminated once and every row operation is applied to all
+ * right-hand sides, so a batch costs little more than a single solve.
+ * Named apart from solve() so that solve(A, {1, 2}) stays unambiguous.
+ *
+ * @param A coefficient matrix shared by the systems
+ * @param B right-hand sides, one per column
+ * @return one solution structure per column of B
+ * @throws std::invalid_argument if B.rows() != A.rows()
+ */
+std::vector<LinearSystemSolution> solve_many(const Matrix &A,
+                                             const Matrix &B);
+
+/**
+ * @brief read the solution of one system off an eliminated pair R, B
+ *
+ * R and B are a row echelon form of A and its right-hand sides as left by
+ * ref_inplace(A, B, pivots); an RREF works as well.  Every solve goes
+ * through here, so all of them report the same shapes.  sol.particular and
+ * sol.null_space are overwritten in place, reusing their buffers.
+ *
+ * @param R row echelon form of the coefficient matrix
+ * @param B right-hand sides in the row order of R
+ * @param col the right-hand side column to solve for
+ * @param pivots pivot and free columns of R
+ * @param sol overwritten with the solution structure
+ * @throws std::invalid_argument if R has a zero pivot
+ */
+void solution_from_ref(const Matrix &R, const Matrix &B, std::size_t col,
+                       const PivotInfo &pivots, LinearSystemSolution &sol);
+
+/**
+ * @brief solve a linear system A|b using scratch memory from ws
+ *
+ * The reduced copies of A and b come from ws, and sol.particular and
+ * sol.null_space are overwritten in place, reusing their buffers.  Solving a
+ * stream of systems of one shape with the same ws and sol therefore makes no
+ * heap allocations after the first call.
+ *
+ * @param A coefficient matrix of a linear system
+ * @param b right-hand side vector of a linear system
+ * @param sol overwritten with the solution structure
+ * @param ws scratch memory
+ * @throws std::invalid_argument if the size of b does not match rows of A
+ */
+void solve(const Matrix &A, const Vector &b, LinearSystemSolution &sol,
+           Workspace &ws);
 } // namespace la
 
 #endif // LINEAR_SYSTEM_HPP
@@ -0,0 +1,139 @@
+#ifndef LA_LU_HPP
+#define LA_LU_HPP
+
+#include "la/matrix.hpp"
+#include "la/permutation.hpp"
+#include "la/triangular_matrix.hpp"
+#include "la/vector.hpp"
+#include "la/workspace.hpp"
+#include <cstddef>
+
+namespace la {
+/**
+ * LU factorization with partial pivoting, PA = LU, of a square matrix.
+ *
+ * L (unit lower, its ones stored) and U are kept as packed
+ * TriangularMatrix factors and solved with trsm; the row order is kept as a
+ * Permutation.  The factorization can follow low-rank changes of A:
+ * update(U, V) replaces A by A + U V^T in O(k n^2) for a rank-k change by
+ * keeping the factors of the last refactored matrix and applying the
+ * accumulated corrections through the Sherman-Morrison-Woodbury identity.
+ * The corrections live in n x n/4 buffers allocated by the first update, and
+ * the K x K capacitance matrix of the accumulated rank K is only extended by
+ * the new rows and columns.  It refactors from scratch when K grows past
+ * n/4, when refactoring the capacitance matrix (K^3) would cost more than
+ * the k n^2 of the update itself, or when it becomes ill-conditioned.
+ */
+class LU {
+  public:
+    /** @return factorization of the empty 0x0 matrix */
+    LU() = default;
+
+    /**
+     * @return factorization of A
+     * @throws std::invalid_argument if A is not square
+     */
+    explicit LU(const Matrix &A);
+
+    /** @return the number of rows (and columns) of A */
+    std::size_t size() const noexcept { return a_.rows(); }
+
+    /** @return the current matrix A, including all updates */
+    const Matrix &matrix() const noexcept { return a_; }
+
+    /** @return the unit lower factor L of the last refactored matrix */
+    const TriangularMatrix &lower() const noexcept { return base_.lower; }
+
+    /** @return the upper factor U of the last refactored matrix */
+    const TriangularMatrix &upper() const noexcept { return base_.upper; }
+
+    /** @return the row order P of the last refactored matrix, PA = LU */
+    const Permutation &permutation() const noexcept { return base_.p; }
+
+    /** @return true if A is (numerically) singular */
+    bool is_singular() const noexcept { return singular_; }
+
+    /**
+     * @return a cheap estimate of the reciprocal condition number of the
+     * last refactored matrix: smallest over largest |U(i, i)|, 0 if singular
+     */
+    double rcond() const noexcept;
+
+    /** @return the rank of the corrections applied since the last refactor */
+    std::size_t correction_rank() const noexcept { return rank_; }
+
+    /**
+     * @return x with A x = b
+     * @throws std::invalid_argument if b.size() != size()
+     * @throws std::domain_error if A is singular
+     */
+    Vector solve(const Vector &b) const;
+
+    /**
+     * @return X with A X = B, one column per right-hand side
+     * @throws std::invalid_argument if B.rows() != size()
+     * @throws std::domain_error if A is singular
+     */
+    Matrix solve(const Matrix &B) const;
+
+    /**
+     * @brief Solve A x = b into x using scratch memory from ws.
+     *
+     * Makes no heap allocations once ws and x have seen a system this size.
+     *
+     * @throws std::invalid_argument if b.size() != size()
+     * @throws std::domain_error if A is singular
+     */
+    void solve(const Vector &b, Vector &x, Workspace &ws) const;
+
+    /**
+     * @brief Solve A X = B into X using scratch memory from ws.
+     * @throws std::invalid_argument if B.rows() != size()
+     * @throws std::domain_error if A is singular
+     */
+    void solve(const Matrix &B, Matrix &X, Workspace &ws) const;
+
+    /** @return det(A), 0 if A is singular */
+    double determinant() const;
+
+    /**
+     * @brief Replace A by A + u v^T (Sherman-Morrison).
+     * @throws std::invalid_argument if u or v does not have size() entries
+     */
+    void update(const Vector &u, const Vector &v);
+
+    /**
+     * @brief Replace A by A + U V^T (Woodbury), U and V are n x k.
+     * @throws std::invalid_argument if U or V is not size() x k
+     */
+    void update(const Matrix &U, const Matrix &V);
+
+    /** @brief Factor the current A from scratch, dropping the corrections. */
+    void refactor();
+
+    /** PA = LU of one square matrix. */
+    struct Factors {
+        TriangularMatrix lower{0, Triangle::Lower};
+        TriangularMatrix upper{0, Triangle::Upper};
+        Permutation p;
+    };
+
+  private:
+    // X = A^{-1} B with T as scratch for the Woodbury correction.
+    void solve_into(const Matrix &B, Matrix &X, Matrix &T) const;
+
+    Matrix a_;      // current A
+    Factors base_;  // factors of A0, the last refactored matrix
+    bool singular_ = false;
+
+    // A = A0 + U V^T with Z = A0^{-1} U, held in the first rank_ columns
+    // of u_, v_ and z_.  The leading rank_ x rank_ block of c_ is the
+    // capacitance matrix I + V^T Z, kept factored in cap_.
+    std::size_t rank_ = 0;
+    Matrix u_, v_, z_;
+    Matrix c_;
+    Factors cap_;
+};
+} // namespace la
+
+#endif // LA_LU_HPP
@@ -1,6 +1,7 @@
 #ifndef LA_MATRIX_HPP
 #define LA_MATRIX_HPP
 
+#include "la/instrument.hpp"
 #include "la/vector.hpp"
 #include <cstddef> // size_t
 #include <initializer_list>
@@ -135,7 +136,7 @@ class Matrix {
      * @return true if the matrices have same number of rows and columns, false
      * otherwise.
      */
-    bool has_same_dimensions(const Matrix m) const {
+    bool has_same_dimensions(const Matrix &m) const {
         return rows_ == m.rows() && cols_ == m.cols();
     }
 
@@ -163,9 +164,24 @@ class Matrix {
     /** @return columns */
     size_t cols() const { return cols_; }
 
-    /** @brief swap rows a and b */
+    /**
+     * @brief swap rows a and b in place, without temporary row copies
+     * @throws std::out_of_range if a or b >= rows()
+     */
     void exchange_rows(std::size_t a, std::size_t b);
 
+    /**
+     * @brief Reshape to rows x cols with every element set to value.
+     *
+     * The existing buffer is reused when it is large enough, so repeated
+     * assigns of the same or smaller size do not allocate.
+     */
+    void assign(std::size_t rows, std::size_t cols, double value = 0.0) {
+        data_.assign(rows * cols, value);
+        rows_ = rows;
+        cols_ = cols;
+    }
+
     /**
      * @brief Create a new matrix from this, with rows [lower, upper)
      *
@@ -233,7 +249,10 @@ class Matrix {
 
     size_t rows_;
     size_t cols_;
-    std::vector<double> data_;
+    instrument::detail::Storage data_;
+#ifdef LA_INSTRUMENT
+    instrument::detail::CopyCounter<instrument::detail::Kind::Matrix> copies_;
+#endif
 };
 
 /**
@@ -2,6 +2,7 @@
 #define LA_MATRIX_LINEAR_SYSTEMS_HPP
 
 #include "matrix.hpp"
+#include "shared.hpp"
 #include "vector.hpp"
 #include <vector>
 
@@ -35,6 +36,14 @@ Matrix augment(const Matrix &A, const Matrix &B);
  */
 bool is_in_span(const std::vector<Vector> &vectors, const Vector &b);
 
+/**
+ *  @brief Determine whether b lies in the span of the given shared vectors
+ *
+ *  Same as the std::vector<Vector> overload, for callers that keep their
+ *  vectors in copy-on-write handles and should not deep-copy them first.
+ */
+bool is_in_span(const std::vector<SharedVector> &vectors, const Vector &b);
+
 /**
  *  @brief Determine whether b lies in the span of the given matrix
  *  @param A matrix
@@ -45,6 +54,19 @@ bool is_in_span(const std::vector<Vector> &vectors, const Vector &b);
  */
 bool is_in_span(const Matrix &A, const Vector &b);
 
+/**
+ *  @brief Test every column of B for membership in the span of A's columns
+ *
+ *  A is eliminated once with all columns of B carried along, so a batch of
+ *  queries against the same A costs about one is_in_span() call.
+ *
+ *  @param A matrix whose columns span the space
+ *  @param B one query vector per column
+ *  @return element j is true if column j of B is in the span of A
+ *  @throws std::invalid_argument if B.rows() != A.rows()
+ */
+std::vector<bool> are_in_span(const Matrix &A, const Matrix &B);
+
 /**
  * @brief Determine whether B is a linear combination of matrices
  * @param B
@@ -65,5 +87,21 @@ bool is_linear_combination(const Matrix &B,
  * @throws std::invalid_argument if the matrix sizes don't match
  */
 bool are_linearly_independent(const std::vector<Matrix> &matrices);
+
+/**
+ * @brief Determine whether a set of shared matrices are linearly independent
+ *
+ * Same as the std::vector<Matrix> overload, for callers that keep their
+ * matrices in copy-on-write handles and should not deep-copy them first.
+ */
+bool are_linearly_independent(const std::vector<SharedMatrix> &matrices);
+
+/**
+ * @brief Determine whether a set of shared vectors are linearly independent
+ *
+ * Same as the std::vector<Vector> overload in vector_algorithms.hpp, for
+ * callers that keep their vectors in copy-on-write handles.
+ */
+bool are_linearly_independent(const std::vector<SharedVector> &vectors);
 } // namespace la
 #endif // LA_MATRIX_LINEAR_SYSTEMS_HPP
@@ -0,0 +1,56 @@
+#ifndef LA_MATRIX_PRODUCTS_HPP
+#define LA_MATRIX_PRODUCTS_HPP
+
+#include "la/matrix.hpp"
+#include "la/vector.hpp"
+
+namespace la {
+/** How a matrix operand enters a product, as is or transposed. */
+enum class Op { None, Transpose };
+
+/**
+ * @brief General matrix product op(A) op(B) (GEMM)
+ *
+ * The kernels read A and B in place with a loop order suited to each
+ * combination of flags, so A^T B and A B^T never materialise a transpose.
+ *
+ * @return op(A) op(B)
+ * @throws std::invalid_argument if the inner dimensions do not match
+ */
+Matrix multiply(const Matrix &A, Op op_a, const Matrix &B, Op op_b);
+
+/**
+ * @brief General matrix vector product op(A) x (GEMV)
+ *
+ * With Op::Transpose this computes A^T x by accumulating scaled rows of A,
+ * without forming transpose(A).
+ *
+ * @return op(A) x
+ * @throws std::invalid_argument if x.size() does not match op(A).cols()
+ */
+Vector multiply(const Matrix &A, Op op_a, const Vector &x);
+
+/**
+ * @brief Gram matrix A^T A
+ *
+ * SYRK-style kernel: reads A row by row without forming transpose(A),
+ * computes the upper triangle in cache-sized blocks and mirrors it, for
+ * roughly half the flops of transpose(A) * A.
+ *
+ * @param A an m x n matrix
+ * @return the n x n symmetric matrix A^T A
+ */
+Matrix gram(const Matrix &A);
+
+/**
+ * @brief outer Gram matrix A A^T
+ *
+ * Same blocking as gram(), with each entry a dot product of two rows of A.
+ *
+ * @param A an m x n matrix
+ * @return the m x m symmetric matrix A A^T
+ */
+Matrix outer_gram(const Matrix &A);
+} // namespace la
+
+#endif // LA_MATRIX_PRODUCTS_HPP
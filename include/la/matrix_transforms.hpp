@@ -2,15 +2,41 @@
 #define LA_MATRIX_TRANSFORMS_HPP
 
 #include "matrix.hpp"
+#include "workspace.hpp"
 
 namespace la {
 /**
  * @brief transpose
+ *
+ * Uses a recursive cache-oblivious split, so both the reads of A and the
+ * writes of the result stay within cache-sized tiles at every level of the
+ * memory hierarchy.
+ *
  * @param A matrix to transpose
  * @return transposed matrix
  */
 Matrix transpose(const Matrix &A);
 
+/**
+ * @brief transpose a square matrix in place, without a second buffer
+ * @param A square matrix to transpose
+ * @throws std::invalid_argument if A is not square
+ */
+void transpose_inplace(Matrix &A);
+
+/**
+ * @brief transpose using several threads
+ *
+ * The result is split into row stripes, each transposed with the same
+ * cache-oblivious kernel as transpose().  Small matrices are transposed on
+ * the calling thread.
+ *
+ * @param A matrix to transpose
+ * @param n_threads number of threads, 0 for std::thread::hardware_concurrency
+ * @return transposed matrix
+ */
+Matrix transpose_parallel(const Matrix &A, unsigned n_threads = 0);
+
 /**
  * @brief is A symmetric
  * @param A matrix to examine
@@ -27,6 +53,47 @@ bool is_symmetric(const Matrix &A);
  */
 bool inverse(const Matrix &in, Matrix &out);
 
+/**
+ * @brief inverse using scratch memory from ws
+ *
+ * Same as inverse(in, out), but the working copy comes from ws and out's
+ * buffer is reused when it already has the right size, so repeated calls
+ * do not allocate.
+ *
+ * @throws std::invalid_argument if in is not a square matrix
+ */
+bool inverse(const Matrix &in, Matrix &out, Workspace &ws);
+
+/**
+ * @brief invert a square matrix in place
+ *
+ * Gauss-Jordan elimination with partial pivoting that overwrites A with its
+ * inverse column by column, so no augmented [A | I] matrix is built.  Row
+ * interchanges are undone as column interchanges at the end.
+ *
+ * @param A the matrix to invert; replaced by the inverse on success, left
+ * in an unspecified state if A is singular
+ * @return true if A was invertible
+ * @throws std::invalid_argument if A is not a square matrix
+ */
+bool inverse_inplace(Matrix &A);
+
+/**
+ * @brief update an explicit inverse after a low-rank change of the matrix
+ *
+ * Given Ainv = A^{-1}, replaces it by (A + U V^T)^{-1} with the
+ * Sherman-Morrison-Woodbury identity in O(k n^2) for n x k matrices U and
+ * V, instead of inverting the changed matrix in O(n^3).
+ *
+ * @param Ainv the inverse of A, replaced by the updated inverse on success
+ * and left unchanged otherwise
+ * @return false if A + U V^T is singular or the k x k correction system is
+ * too ill-conditioned to trust; invert the changed matrix instead
+ * @throws std::invalid_argument if Ainv is not square or U and V are not
+ * both Ainv.rows() x k
+ */
+bool update_inverse(Matrix &Ainv, const Matrix &U, const Matrix &V);
+
 } // namespace la
 
 #endif // LA_MATRIX_TRANSFORMS_HPP
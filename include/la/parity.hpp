@@ -1,8 +1,14 @@
 #ifndef LA_PARITY_HPP
 #define LA_PARITY_HPP
 
+#include "la/bit_matrix.hpp"
 #include <bitset>
+#include <cstddef>
+#include <iterator>
 #include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 namespace la {
 /**
@@ -84,7 +90,7 @@ T check_digit(It first, It last, T m) {
  * @return the check digit in the range [0, 9]
  * @throws std::invalid argument if size of v != 11
  */
-int upc_check_digit(std::vector<int> v);
+int upc_check_digit(const std::vector<int> &v);
 
 /**
  * @brief Checks whether the UPC code has an error.
@@ -93,7 +99,7 @@ int upc_check_digit(std::vector<int> v);
  * @return true if the code has an error, false if not.
  * @throws std::invalid argument if size of v != 12
  */
-bool upc_has_error(std::vector<int> v);
+bool upc_has_error(const std::vector<int> &v);
 
 /**
  * @brief Computes the check digit for ISBN code vector.
@@ -102,7 +108,7 @@ bool upc_has_error(std::vector<int> v);
  * @return the check digit in the range [0, 9]
  * @throws std::invalid argument if size of v != 9
  */
-int isbn10_check_digit(std::vector<int> v);
+int isbn10_check_digit(const std::vector<int> &v);
 
 /**
  * @brief Checks whether the ISBN code has an error.
@@ -111,7 +117,81 @@ int isbn10_check_digit(std::vector<int> v);
  * @return true if the code has an error, false if not.
  * @throws std::invalid argument if size of v != 10
  */
-bool isbn10_has_error(std::vector<int> v);
+bool isbn10_has_error(const std::vector<int> &v);
+
+/**
+ * @brief Checks fixed-width ASCII UPC codes in bulk.
+ *
+ * Code i is the 12 characters starting at codes + i * stride, so text with
+ * one code per line has stride 13.  Whatever lies between codes is not
+ * read.  A code fails if one of its characters is not a digit or its
+ * check digit is wrong.  No memory is allocated per code.
+ *
+ * @param codes the first character of the first code
+ * @param count the number of codes
+ * @param stride the distance between the starts of consecutive codes
+ * @param failed resized to count; bit i is set when code i fails
+ * @return the number of failed codes
+ * @throws std::invalid_argument if stride < 12
+ */
+std::size_t upc_find_errors(const char *codes, std::size_t count,
+                            std::size_t stride, BitVector &failed);
+
+/**
+ * @brief Checks fixed-width ASCII UPC codes in bulk.
+ * @param failures overwritten with the indices of the failed codes,
+ * ascending
+ * @return the number of failed codes
+ * @throws std::invalid_argument if stride < 12
+ */
+std::size_t upc_find_errors(const char *codes, std::size_t count,
+                            std::size_t stride,
+                            std::vector<std::size_t> &failures);
+
+/**
+ * @brief Writes the check digit of fixed-width ASCII UPC codes in place.
+ *
+ * The first 11 characters of code i (at codes + i * stride) are its
+ * digits; the 12th is overwritten with the check digit.  Codes with a
+ * character other than a digit among the 11 are left unchanged.
+ *
+ * @return the number of codes left unchanged
+ * @throws std::invalid_argument if stride < 12
+ */
+std::size_t upc_complete(char *codes, std::size_t count, std::size_t stride);
+
+/**
+ * @brief Checks fixed-width ASCII ISBN-10 codes in bulk.
+ *
+ * Like upc_find_errors() for codes of 10 characters.  The check character
+ * may be 'X' (or 'x') for 10.
+ *
+ * @param failed resized to count; bit i is set when code i fails
+ * @return the number of failed codes
+ * @throws std::invalid_argument if stride < 10
+ */
+std::size_t isbn10_find_errors(const char *codes, std::size_t count,
+                               std::size_t stride, BitVector &failed);
+
+/**
+ * @brief Checks fixed-width ASCII ISBN-10 codes in bulk.
+ * @param failures overwritten with the indices of the failed codes,
+ * ascending
+ * @return the number of failed codes
+ * @throws std::invalid_argument if stride < 10
+ */
+std::size_t isbn10_find_errors(const char *codes, std::size_t count,
+                               std::size_t stride,
+                               std::vector<std::size_t> &failures);
+
+/**
+ * @brief Writes the check character of fixed-width ASCII ISBN-10 codes in
+ * place: the 10th character becomes a digit, or 'X' for 10.
+ * @return the number of codes left unchanged because of a non-digit
+ * @throws std::invalid_argument if stride < 10
+ */
+std::size_t isbn10_complete(char *codes, std::size_t count,
+                            std::size_t stride);
 } // namespace la
 
 #endif
@@ -0,0 +1,124 @@
+#ifndef LA_PERMUTATION_HPP
+#define LA_PERMUTATION_HPP
+
+#include "la/matrix.hpp"
+#include "la/vector.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace la {
+/**
+ * A permutation of the indices [0, n).
+ *
+ * Stored in "new to old" form: p[i] is the original index that is placed at
+ * position i.  Applying p to a vector x gives y with y[i] = x[p[i]].
+ */
+class Permutation {
+  public:
+    /** @return empty permutation of size 0 */
+    Permutation() = default;
+
+    /** @return identity permutation of size n */
+    explicit Permutation(std::size_t n);
+
+    /**
+     * @return permutation from explicit "new to old" indices
+     * @throws std::invalid_argument if indices is not a permutation of
+     * [0, indices.size())
+     */
+    explicit Permutation(std::vector<std::size_t> indices);
+
+    /** @return the number of permuted indices */
+    std::size_t size() const { return indices_.size(); }
+
+    /** @return the original index placed at position i, without range check */
+    std::size_t operator[](std::size_t i) const noexcept {
+        return indices_[i];
+    }
+
+    /** @return the "new to old" index table */
+    const std::vector<std::size_t> &indices() const noexcept {
+        return indices_;
+    }
+
+    /** @return the inverse permutation ("old to new") */
+    Permutation inverse() const;
+
+    /**
+     * @brief Exchange the entries at positions a and b.
+     *
+     * This is how a row interchange is recorded instead of performed.
+     * @throws std::out_of_range if a or b >= size()
+     */
+    void swap(std::size_t a, std::size_t b);
+
+    /** @return +1 for an even permutation, -1 for an odd one */
+    int sign() const;
+
+    /** @return true if the permutations map every index the same way */
+    friend bool operator==(const Permutation &a, const Permutation &b) {
+        return a.indices_ == b.indices_;
+    }
+
+    /** @return true if the permutations differ */
+    friend bool operator!=(const Permutation &a, const Permutation &b) {
+        return !(a == b);
+    }
+
+  private:
+    std::vector<std::size_t> indices_;
+};
+
+/**
+ * @brief Reorder a vector by a permutation, y[i] = v[p[i]]
+ * @throws std::invalid_argument if the sizes don't match
+ */
+Vector permute(const Vector &v, const Permutation &p);
+
+/**
+ * @brief Undo permute(), y[p[i]] = v[i]
+ * @throws std::invalid_argument if the sizes don't match
+ */
+Vector unpermute(const Vector &v, const Permutation &p);
+
+/**
+ * @brief Reorder the rows of A, row i of the result is row p[i] of A (PA)
+ * @throws std::invalid_argument if p.size() != A.rows()
+ */
+Matrix permute_rows(const Matrix &A, const Permutation &p);
+
+/**
+ * @brief permute_rows() without a second matrix
+ *
+ * Follows the cycles of p and exchanges whole rows in place, so at most
+ * A.rows() - 1 row swaps are made and no row is copied.
+ * @throws std::invalid_argument if p.size() != A.rows()
+ */
+void permute_rows_inplace(Matrix &A, const Permutation &p);
+
+/**
+ * @brief Undo permute_rows(), row p[i] of the result is row i of A
+ * @throws std::invalid_argument if p.size() != A.rows()
+ */
+Matrix unpermute_rows(const Matrix &A, const Permutation &p);
+
+/**
+ * @brief Reorder the columns of A, column j of the result is column p[j] of A
+ * @throws std::invalid_argument if p.size() != A.cols()
+ */
+Matrix permute_cols(const Matrix &A, const Permutation &p);
+
+/**
+ * @brief Undo permute_cols(), column p[j] of the result is column j of A
+ * @throws std::invalid_argument if p.size() != A.cols()
+ */
+Matrix unpermute_cols(const Matrix &A, const Permutation &p);
+
+/**
+ * @brief Symmetric reordering P A P^T, result(i, j) = A(p[i], p[j])
+ * @throws std::invalid_argument if A is not square or p.size() != A.rows()
+ */
+Matrix permute_symmetric(const Matrix &A, const Permutation &p);
+} // namespace la
+
+#endif // LA_PERMUTATION_HPP
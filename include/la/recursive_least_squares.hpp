@@ -0,0 +1,84 @@
+#ifndef LA_RECURSIVE_LEAST_SQUARES_HPP
+#define LA_RECURSIVE_LEAST_SQUARES_HPP
+
+#include "la/triangular_matrix.hpp"
+#include "la/vector.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace la {
+/**
+ * Least squares min ||A x - b|| over observations that arrive one row at a
+ * time, by updating a QR factorization.
+ *
+ * Only the triangular factor of [A | b] is kept, an (n+1) x (n+1) upper
+ * triangular matrix [R z; 0 rho] with R x = z the normal solution and
+ * |rho| the residual norm.  A new row is folded in with n+1 Givens
+ * rotations and an old one removed with hyperbolic rotations, both in
+ * O(n^2), so the state does not grow with the number of rows.
+ *
+ * With a forgetting factor lambda < 1 the factor is scaled by
+ * sqrt(lambda) before each new row, which weights the row seen k steps ago
+ * by lambda^k.
+ */
+class RecursiveLeastSquares {
+  public:
+    /**
+     * @return empty problem in n unknowns
+     * @throws std::invalid_argument if forgetting is not in (0, 1]
+     */
+    explicit RecursiveLeastSquares(std::size_t n, double forgetting = 1.0);
+
+    /** @return the number of unknowns */
+    std::size_t size() const noexcept { return n_; }
+
+    /** @return the forgetting factor */
+    double forgetting() const noexcept { return lambda_; }
+
+    /** @return rows added minus rows removed */
+    std::size_t observations() const noexcept { return observations_; }
+
+    /**
+     * @brief Add the observation a^T x = b.
+     * @throws std::invalid_argument if a.size() != size()
+     */
+    void add(const Vector &a, double b);
+
+    /**
+     * @brief Remove an observation added earlier, e.g. the oldest row of a
+     * sliding window.
+     *
+     * The row is taken out at full weight, so this is meant for a
+     * forgetting factor of 1.
+     *
+     * @throws std::invalid_argument if a.size() != size()
+     * @throws std::domain_error if the remaining rows no longer determine x;
+     * the state is left unchanged
+     */
+    void remove(const Vector &a, double b);
+
+    /** @return true if the rows so far determine x uniquely */
+    bool is_full_rank() const noexcept;
+
+    /**
+     * @return the least squares solution, by back substitution in O(n^2)
+     * @throws std::domain_error if !is_full_rank()
+     */
+    Vector solution() const;
+
+    /** @return the residual norm ||A x - b|| of the (weighted) rows */
+    double residual_norm() const noexcept;
+
+    /** @brief Forget every observation. */
+    void clear();
+
+  private:
+    std::size_t n_;
+    double lambda_;
+    std::size_t observations_ = 0;
+    TriangularMatrix s_;       // [R z; 0 rho]
+    std::vector<double> work_; // the incoming row [a b]
+};
+} // namespace la
+
+#endif // LA_RECURSIVE_LEAST_SQUARES_HPP
@@ -0,0 +1,36 @@
+#ifndef LA_REORDERING_HPP
+#define LA_REORDERING_HPP
+
+#include "la/matrix.hpp"
+#include "la/permutation.hpp"
+#include <cstddef>
+
+namespace la {
+/**
+ * @brief half-bandwidth of a square matrix
+ * @param A the matrix
+ * @return max |i - j| over the nonzero entries A(i, j), 0 for a diagonal or
+ * empty matrix
+ * @throws std::invalid_argument if A is not square
+ */
+std::size_t bandwidth(const Matrix &A);
+
+/**
+ * @brief Reverse Cuthill-McKee ordering of a square matrix
+ *
+ * The graph is taken from the nonzero pattern of A + A^T, so unsymmetric
+ * matrices are reordered by their symmetrised structure.  Each connected
+ * component is started from a pseudo-peripheral node and traversed
+ * breadth-first with neighbours in increasing degree order.
+ *
+ * Apply the result with permute_symmetric(A, p), permute(b, p), and map a
+ * solution of the reordered system back with unpermute(y, p).
+ *
+ * @param A the matrix whose bandwidth to reduce
+ * @return the bandwidth-reducing symmetric permutation
+ * @throws std::invalid_argument if A is not square
+ */
+Permutation rcm_permutation(const Matrix &A);
+} // namespace la
+
+#endif // LA_REORDERING_HPP
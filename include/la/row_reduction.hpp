@@ -2,6 +2,9 @@
 #define LA_ROW_REDUCTION_HPP
 
 #include "la/matrix.hpp"
+#include "la/permutation.hpp"
+#include "la/pivot_info.hpp"
+#include "la/workspace.hpp"
 
 namespace la {
 /**
@@ -27,6 +30,78 @@ bool is_rref(const Matrix &A);
  */
 Matrix ref(const Matrix &A);
 
+/**
+ * @brief reduce A to row echelon form in place
+ *
+ * Same elimination as ref(), without the defensive copy.
+ *
+ * @param A the matrix to reduce, overwritten with its REF
+ * @return the pivot columns of the REF and the remaining free columns
+ */
+PivotInfo ref_inplace(Matrix &A);
+
+/**
+ * @brief reduce A to row echelon form in place, reusing info's buffers
+ * @param A the matrix to reduce, overwritten with its REF
+ * @param info overwritten with the pivot and free columns of the REF
+ */
+void ref_inplace(Matrix &A, PivotInfo &info);
+
+/**
+ * @brief reduce A to row echelon form in place, carrying B along
+ *
+ * Every row operation on A is applied to B as well, so the result is the
+ * same as reducing [A | B] but without building the augmented matrix.
+ * Pivots are only taken from A.
+ *
+ * @param A the matrix to reduce, overwritten with its REF
+ * @param B right-hand sides, overwritten with the same row operations
+ * @param info overwritten with the pivot and free columns of A's REF
+ * @throws std::invalid_argument if B.rows() != A.rows()
+ */
+void ref_inplace(Matrix &A, Matrix &B, PivotInfo &info);
+
+/**
+ * @brief reduce A to row echelon form without moving any rows
+ *
+ * Row interchanges are recorded in rows instead of being carried out, so
+ * no row data is moved during the elimination.  Logical row i of the REF
+ * is physical row rows[i] of A, i.e. the REF is permute_rows(A, rows);
+ * permute_rows_inplace(A, rows) materialises it.
+ *
+ * @param A the matrix to reduce, overwritten with its REF in permuted order
+ * @param info overwritten with the pivot and free columns of the REF
+ * @param rows overwritten with the row order of the REF
+ */
+void ref_inplace(Matrix &A, PivotInfo &info, Permutation &rows);
+
+/**
+ * @brief reduce A to reduced row echelon form in place
+ * @param A the matrix to reduce, overwritten with its RREF
+ * @return the pivot columns of the RREF and the remaining free columns
+ */
+PivotInfo rref_inplace(Matrix &A);
+
+/**
+ * @brief reduce A to reduced row echelon form in place, carrying B along
+ * @param A the matrix to reduce, overwritten with its RREF
+ * @param B right-hand sides, overwritten with the same row operations
+ * @return the pivot columns of A's RREF and the remaining free columns
+ * @throws std::invalid_argument if B.rows() != A.rows()
+ */
+PivotInfo rref_inplace(Matrix &A, Matrix &B);
+
+/**
+ * @brief reduce A to reduced row echelon form without moving any rows
+ *
+ * Like ref_inplace(A, info, rows): the RREF is permute_rows(A, rows).
+ *
+ * @param A the matrix to reduce, overwritten with its RREF in permuted order
+ * @param rows overwritten with the row order of the RREF
+ * @return the pivot columns of the RREF and the remaining free columns
+ */
+PivotInfo rref_inplace(Matrix &A, Permutation &rows);
+
 /**
  * @brief return a reduced row echelon form of matrix
  * @param A the matrix
@@ -39,6 +114,12 @@ Matrix rref(const Matrix &A);
  */
 std::size_t rank(const Matrix &A);
 
+/**
+ * @brief rank using scratch memory from ws instead of a fresh copy of A
+ * @return the number on nonzero rows in row echelon form
+ */
+std::size_t rank(const Matrix &A, Workspace &ws);
+
 /**
  * @brief Determine rank of matrix in REF
  * @param R Matrix in row-echlon form
@@ -0,0 +1,66 @@
+#ifndef LA_SHARED_HPP
+#define LA_SHARED_HPP
+
+#include "la/matrix.hpp"
+#include "la/vector.hpp"
+#include <memory>
+#include <utility>
+
+namespace la {
+/**
+ * Reference-counted, copy-on-write handle to a Matrix or Vector.
+ *
+ * Copying a handle is O(1) and shares the underlying buffer.  Reading goes
+ * through get() (or the implicit conversion to const T&, so a handle can be
+ * passed straight to the library functions).  The first mutate() on a
+ * shared handle makes a private deep copy; later mutations are free.
+ *
+ * Like std::shared_ptr, different handles may be used from different
+ * threads, but one handle must not be copied and mutated concurrently.
+ */
+template <typename T> class Shared {
+  public:
+    /** @return handle to a default-constructed value */
+    Shared() : ptr_(std::make_shared<T>()) {}
+
+    /** @return handle owning value */
+    explicit Shared(T value) : ptr_(std::make_shared<T>(std::move(value))) {}
+
+    /** @return read-only access to the shared value */
+    const T &get() const noexcept { return *ptr_; }
+
+    /** @return read-only access to the shared value */
+    operator const T &() const noexcept { return *ptr_; }
+
+    /** @return read-only access to the shared value */
+    const T *operator->() const noexcept { return ptr_.get(); }
+
+    /**
+     * @return writeable access, deep-copying first if the value is shared
+     *
+     * The reference is invalidated by copying this handle.
+     */
+    T &mutate() {
+        if (ptr_.use_count() > 1) {
+            ptr_ = std::make_shared<T>(*ptr_);
+        }
+        return *ptr_;
+    }
+
+    /** @return true if other handles refer to the same value */
+    bool is_shared() const noexcept { return ptr_.use_count() > 1; }
+
+    /** @return true if both handles refer to the same buffer */
+    friend bool same_buffer(const Shared &a, const Shared &b) noexcept {
+        return a.ptr_ == b.ptr_;
+    }
+
+  private:
+    std::shared_ptr<T> ptr_;
+};
+
+using SharedMatrix = Shared<Matrix>;
+using SharedVector = Shared<Vector>;
+} // namespace la
+
+#endif // LA_SHARED_HPP
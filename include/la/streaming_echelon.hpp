@@ -0,0 +1,84 @@
+#ifndef LA_STREAMING_ECHELON_HPP
+#define LA_STREAMING_ECHELON_HPP
+
+#include "la/linear_system.hpp"
+#include "la/matrix.hpp"
+#include "la/pivot_info.hpp"
+#include "la/vector.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace la {
+/**
+ * The reduced row echelon form of a linear system A x = b that grows one
+ * equation at a time.
+ *
+ * Only the nonzero rows of the RREF of [A | b] are kept.  A new equation is
+ * reduced against them and, if it brings a new pivot, used to clear its
+ * pivot column from the rows already there.  Both steps cost O(r n) for n
+ * variables and rank r, so rank, pivots and consistency are current after
+ * every row without eliminating the whole system again.  Because the RREF
+ * of a row space is unique, the pivots are the same as those of
+ * eliminate_system() on all the rows seen so far.
+ *
+ * A row counts as dependent when everything left after the reduction is
+ * effectively zero relative to the largest coefficient of that row.
+ */
+class StreamingEchelon {
+  public:
+    /** @return empty system in n variables */
+    explicit StreamingEchelon(std::size_t n);
+
+    /** @return the number of variables */
+    std::size_t variables() const noexcept { return n_; }
+
+    /** @return the number of equations added so far */
+    std::size_t rows_seen() const noexcept { return rows_seen_; }
+
+    /** @return the rank of A */
+    std::size_t rank() const noexcept { return pivots_.pivot_cols.size(); }
+
+    /** @return false once some equation contradicts the earlier ones */
+    bool is_consistent() const noexcept { return consistent_; }
+
+    /** @return pivot and free columns of A, in the row order of the RREF */
+    const PivotInfo &pivots() const noexcept { return pivots_; }
+
+    /**
+     * @brief Add the equation a^T x = b.
+     * @return true if the row was independent and the rank grew
+     * @throws std::invalid_argument if a.size() != variables()
+     */
+    bool add_row(const Vector &a, double b);
+
+    /**
+     * @return the nonzero rows of the RREF of [A | b], rank() x
+     * (variables() + 1)
+     */
+    Matrix reduced() const;
+
+    /** @return the solution set of the equations added so far */
+    LinearSystemSolution solution() const;
+
+    /** @brief Remove every equation, keeping the allocated storage. */
+    void clear();
+
+  private:
+    // Pointer to the stored row with logical (RREF) position i.
+    double *row(std::size_t i) { return rows_.data() + order_[i] * stride_; }
+    const double *row(std::size_t i) const {
+        return rows_.data() + order_[i] * stride_;
+    }
+
+    std::size_t n_;
+    std::size_t stride_; // n_ + 1, the RHS is the last entry of a row
+    std::size_t rows_seen_ = 0;
+    bool consistent_ = true;
+    PivotInfo pivots_;
+    std::vector<std::size_t> order_; // storage slot of each RREF row
+    std::vector<double> rows_;       // rank() rows of stride_ entries
+    std::vector<double> work_;       // the incoming row
+};
+} // namespace la
+
+#endif // LA_STREAMING_ECHELON_HPP
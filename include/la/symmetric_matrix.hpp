@@ -0,0 +1,98 @@
+#ifndef LA_SYMMETRIC_MATRIX_HPP
+#define LA_SYMMETRIC_MATRIX_HPP
+
+#include "la/matrix.hpp"
+#include "la/vector.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace la {
+/**
+ * An n x n symmetric matrix in packed storage.
+ *
+ * Only the upper triangle (n(n+1)/2 entries) is kept, row by row.  Reading
+ * or writing (i, j) and (j, i) refers to the same element.
+ */
+class SymmetricMatrix {
+  public:
+    /** @return empty 0x0 matrix */
+    SymmetricMatrix() : n_(0) {}
+
+    /** @return n x n symmetric matrix initialised to value */
+    explicit SymmetricMatrix(std::size_t n, double value = 0.0)
+        : n_(n), data_(n * (n + 1) / 2, value) {}
+
+    /**
+     * @return symmetric matrix from the upper triangle of A
+     *
+     * The lower triangle of A is not read, so A is not checked for symmetry;
+     * use is_symmetric() first if that matters.
+     *
+     * @throws std::invalid_argument if A is not square
+     */
+    explicit SymmetricMatrix(const Matrix &A);
+
+    /** @return the element at i,j without range check */
+    double operator()(std::size_t i, std::size_t j) const noexcept {
+        return data_[index(i, j)];
+    }
+
+    /** @return the element at i,j (and j,i), writeable, no range check */
+    double &operator()(std::size_t i, std::size_t j) noexcept {
+        return data_[index(i, j)];
+    }
+
+    /**
+     * @return the element at i,j (and j,i), writeable and with range check
+     * @throws std::out_of_range if i or j is out of range
+     */
+    double &at(std::size_t i, std::size_t j);
+
+    /** @return true if the matrices have same size and elements */
+    friend bool operator==(const SymmetricMatrix &a,
+                           const SymmetricMatrix &b) {
+        return a.n_ == b.n_ && a.data_ == b.data_;
+    }
+
+    /** @return rows */
+    std::size_t rows() const { return n_; }
+
+    /** @return columns */
+    std::size_t cols() const { return n_; }
+
+  private:
+    // Row-major packed upper triangle: row i holds columns [i, n).
+    std::size_t index(std::size_t i, std::size_t j) const noexcept {
+        if (i > j) {
+            std::size_t t = i;
+            i = j;
+            j = t;
+        }
+        return i * (2 * n_ - i + 1) / 2 + (j - i);
+    }
+
+    std::size_t n_;
+    std::vector<double> data_;
+};
+
+/** @return the symmetric matrix as a full Matrix with both triangles */
+Matrix to_matrix(const SymmetricMatrix &S);
+
+/**
+ * @brief symmetric matrix vector product (SYMV)
+ * @return S x
+ * @throws std::invalid_argument if x.size() != S.cols()
+ */
+Vector symv(const SymmetricMatrix &S, const Vector &x);
+
+/**
+ * @brief symmetric rank-k product (SYRK)
+ *
+ * Computes only the upper triangle of A A^T, reading rows of A directly.
+ *
+ * @return A A^T as a packed symmetric matrix of size A.rows()
+ */
+SymmetricMatrix syrk(const Matrix &A);
+} // namespace la
+
+#endif // LA_SYMMETRIC_MATRIX_HPP
@@ -0,0 +1,143 @@
+#ifndef LA_TRIANGULAR_MATRIX_HPP
+#define LA_TRIANGULAR_MATRIX_HPP
+
+#include "la/matrix.hpp"
+#include "la/vector.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace la {
+/** Which triangle of a square matrix is stored. */
+enum class Triangle { Upper, Lower };
+
+/**
+ * An n x n upper or lower triangular matrix in packed storage.
+ *
+ * Only the n(n+1)/2 entries of the stored triangle are kept, row by row.
+ * Entries outside the triangle read as zero and cannot be written, so
+ * elements are written through at() or row_data().
+ */
+class TriangularMatrix {
+  public:
+    /** @return empty 0x0 upper triangular matrix */
+    TriangularMatrix() : n_(0), uplo_(Triangle::Upper) {}
+
+    /** @return n x n triangular matrix with the triangle set to value */
+    TriangularMatrix(std::size_t n, Triangle uplo, double value = 0.0)
+        : n_(n), uplo_(uplo), data_(n * (n + 1) / 2, value) {}
+
+    /**
+     * @return the uplo triangle of the square matrix A
+     * @throws std::invalid_argument if A is not square
+     */
+    TriangularMatrix(const Matrix &A, Triangle uplo);
+
+    /** @return the element at i,j, zero outside the triangle */
+    double operator()(std::size_t i, std::size_t j) const noexcept {
+        return in_triangle(i, j) ? data_[index(i, j)] : 0.0;
+    }
+
+    /**
+     * @return pointer to the stored part of row i, without range check
+     *
+     * For an upper matrix the row starts at column i and has n - i entries,
+     * for a lower matrix it starts at column 0 and has i + 1 entries.
+     */
+    double *row_data(std::size_t i) noexcept {
+        return data_.data() + index(i, first_col(i));
+    }
+
+    /** @copydoc row_data */
+    const double *row_data(std::size_t i) const noexcept {
+        return data_.data() + index(i, first_col(i));
+    }
+
+    /** @return first stored column of row i */
+    std::size_t first_col(std::size_t i) const noexcept {
+        return uplo_ == Triangle::Upper ? i : 0;
+    }
+
+    /** @return one past the last stored column of row i */
+    std::size_t last_col(std::size_t i) const noexcept {
+        return uplo_ == Triangle::Upper ? n_ : i + 1;
+    }
+
+    /**
+     * @return the element at i,j, writeable and with range check
+     * @throws std::out_of_range if (i, j) is outside the matrix or the
+     * stored triangle
+     */
+    double &at(std::size_t i, std::size_t j);
+
+    /** @return true if the matrices have same shape, triangle and elements */
+    friend bool operator==(const TriangularMatrix &a,
+                           const TriangularMatrix &b) {
+        return a.n_ == b.n_ && a.uplo_ == b.uplo_ && a.data_ == b.data_;
+    }
+
+    /** @return rows */
+    std::size_t rows() const { return n_; }
+
+    /** @return columns */
+    std::size_t cols() const { return n_; }
+
+    /** @return the stored triangle */
+    Triangle triangle() const { return uplo_; }
+
+    /** @return true if (i, j) lies inside the stored triangle */
+    bool in_triangle(std::size_t i, std::size_t j) const noexcept {
+        return uplo_ == Triangle::Upper ? i <= j : j <= i;
+    }
+
+  private:
+    // Row-major packed offsets: upper row i holds columns [i, n), lower row
+    // i holds columns [0, i].
+    std::size_t index(std::size_t i, std::size_t j) const noexcept {
+        return uplo_ == Triangle::Upper ? i * (2 * n_ - i + 1) / 2 + (j - i)
+                                        : i * (i + 1) / 2 + j;
+    }
+
+    std::size_t n_;
+    Triangle uplo_;
+    std::vector<double> data_;
+};
+
+/**
+ * @brief Take the uplo triangle of the leading n x n block of A.
+ *
+ * Useful for reading the coefficient part of an echelon form [U | b]
+ * without first copying it out with col_range.
+ *
+ * @throws std::out_of_range if n > A.rows() or n > A.cols()
+ */
+TriangularMatrix leading_triangle(const Matrix &A, std::size_t n,
+                                  Triangle uplo);
+
+/** @return the triangular matrix as a full Matrix with explicit zeros */
+Matrix to_matrix(const TriangularMatrix &T);
+
+/**
+ * @brief triangular matrix vector product (TRMV)
+ * @return T x
+ * @throws std::invalid_argument if x.size() != T.cols()
+ */
+Vector trmv(const TriangularMatrix &T, const Vector &x);
+
+/**
+ * @brief triangular solve (TRSV)
+ * @return x such that T x = b
+ * @throws std::invalid_argument if b.size() != T.rows()
+ * @throws std::domain_error if T has a zero on the diagonal
+ */
+Vector trsv(const TriangularMatrix &T, const Vector &b);
+
+/**
+ * @brief triangular solve with many right-hand sides (TRSM)
+ * @return X such that T X = B
+ * @throws std::invalid_argument if B.rows() != T.rows()
+ * @throws std::domain_error if T has a zero on the diagonal
+ */
+Matrix trsm(const TriangularMatrix &T, const Matrix &B);
+} // namespace la
+
+#endif // LA_TRIANGULAR_MATRIX_HPP
@@ -1,6 +1,7 @@
 #ifndef LA_VECTOR_HPP
 #define LA_VECTOR_HPP
 
+#include "la/instrument.hpp"
 #include "utils/utils.hpp"
 #include <initializer_list>
 #include <ostream>
@@ -13,6 +14,8 @@ namespace la {
 class Vector {
   public:
     using value_type = double;
+    using iterator = instrument::detail::Storage::iterator;
+    using const_iterator = instrument::detail::Storage::const_iterator;
 
     // --- constructors ---
     Vector() = default;
@@ -33,6 +36,13 @@ class Vector {
     /** @return whether the vector is empty (length zero) */
     bool empty() const { return data_.empty(); }
 
+    /**
+     * @brief Resize to s elements, all set to value.
+     *
+     * The existing buffer is reused when it is large enough.
+     */
+    void assign(std::size_t s, double value = 0.0) { data_.assign(s, value); }
+
     // --- element access ---
     // checked
     double &at(std::size_t i) { return data_.at(i); }
@@ -50,14 +60,10 @@ class Vector {
     const double *data() const noexcept { return data_.data(); }
 
     // --- iterators (STL-friendly) ---
-    std::vector<double>::iterator begin() noexcept { return data_.begin(); }
-    std::vector<double>::const_iterator begin() const noexcept {
-        return data_.begin();
-    }
-    std::vector<double>::iterator end() noexcept { return data_.end(); }
-    std::vector<double>::const_iterator end() const noexcept {
-        return data_.end();
-    }
+    iterator begin() noexcept { return data_.begin(); }
+    const_iterator begin() const noexcept { return data_.begin(); }
+    iterator end() noexcept { return data_.end(); }
+    const_iterator end() const noexcept { return data_.end(); }
 
     // --- comparison ---
     /** @return true if the vector elements are the same */
@@ -113,11 +119,12 @@ class Vector {
     Vector tail(std::size_t start = 1) const;
 
   private:
-    Vector(std::vector<double>::const_iterator first,
-           std::vector<double>::const_iterator last)
-        : data_(first, last) {}
+    Vector(const_iterator first, const_iterator last) : data_(first, last) {}
 
-    std::vector<double> data_;
+    instrument::detail::Storage data_;
+#ifdef LA_INSTRUMENT
+    instrument::detail::CopyCounter<instrument::detail::Kind::Vector> copies_;
+#endif
 };
 
 /** @return vector multiplied by the scalar c */
@@ -58,7 +58,7 @@ inline bool has_leading_one(const Vector &v) {
  *  @return true if the vectors are linearly independent
  *  @throws std::invalid_argument if the vector sizes don't match
  */
-bool are_linearly_independent(const std::vector<Vector> vectors);
+bool are_linearly_independent(const std::vector<Vector> &vectors);
 
 } // namespace la
 
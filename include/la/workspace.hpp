@@ -0,0 +1,69 @@
+#ifndef LA_WORKSPACE_HPP
+#define LA_WORKSPACE_HPP
+
+#include "la/matrix.hpp"
+#include "la/pivot_info.hpp"
+#include "la/vector.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace la {
+/**
+ * Reusable scratch memory for the solver functions.
+ *
+ * A bump allocator over pooled buffers: each request hands out the next
+ * free Matrix, Vector, index list or PivotInfo, reshaped to the requested
+ * size, and reset() returns all of them to the pool.  Buffers keep their
+ * capacity across resets, so once a workspace has seen the largest problem
+ * of a loop, further calls with it make no heap allocations.
+ *
+ * Everything handed out stays valid until the next reset().  The functions
+ * that take a Workspace& call reset() themselves on entry, so a workspace
+ * must not be shared between threads or between nested calls.
+ */
+class Workspace {
+  public:
+    Workspace() = default;
+    Workspace(const Workspace &) = delete;
+    Workspace &operator=(const Workspace &) = delete;
+
+    /** @return a zero-filled rows x cols scratch matrix */
+    Matrix &matrix(std::size_t rows, std::size_t cols);
+
+    /** @return a scratch matrix holding a copy of A */
+    Matrix &copy(const Matrix &A);
+
+    /** @return a zero-filled scratch vector of size n */
+    Vector &vector(std::size_t n);
+
+    /** @return an empty scratch index list */
+    std::vector<std::size_t> &indices();
+
+    /** @return an empty scratch PivotInfo */
+    PivotInfo &pivots();
+
+    /** @brief Return every buffer to the pool, keeping their capacity. */
+    void reset() noexcept {
+        matrices_used_ = 0;
+        vectors_used_ = 0;
+        indices_used_ = 0;
+        pivots_used_ = 0;
+    }
+
+  private:
+    template <typename T>
+    static T &next(std::vector<std::unique_ptr<T>> &pool, std::size_t &used);
+
+    std::vector<std::unique_ptr<Matrix>> matrices_;
+    std::vector<std::unique_ptr<Vector>> vectors_;
+    std::vector<std::unique_ptr<std::vector<std::size_t>>> indices_;
+    std::vector<std::unique_ptr<PivotInfo>> pivots_;
+    std::size_t matrices_used_ = 0;
+    std::size_t vectors_used_ = 0;
+    std::size_t indices_used_ = 0;
+    std::size_t pivots_used_ = 0;
+};
+} // namespace la
+
+#endif // LA_WORKSPACE_HPP
@@ -0,0 +1,49 @@
+#ifndef UTILS_JOINING_THREADS_HPP
+#define UTILS_JOINING_THREADS_HPP
+
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace utils {
+/**
+ * Worker threads that are joined when the group goes out of scope.
+ *
+ * If starting a thread throws, the threads already started are joined
+ * during unwinding instead of reaching std::terminate as joinable
+ * std::thread objects.  Declare the group after the data the workers use,
+ * so it is joined before that data is destroyed.
+ */
+class JoiningThreads {
+  public:
+    explicit JoiningThreads(std::size_t expected) {
+        threads_.reserve(expected);
+    }
+
+    JoiningThreads(const JoiningThreads &) = delete;
+    JoiningThreads &operator=(const JoiningThreads &) = delete;
+
+    ~JoiningThreads() { join(); }
+
+    /** @brief Start a thread running f(args...). */
+    template <typename F, typename... Args>
+    void spawn(F &&f, Args &&...args) {
+        threads_.emplace_back(std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    /** @brief Wait for every started thread. */
+    void join() {
+        for (auto &t : threads_) {
+            if (t.joinable()) {
+                t.join();
+            }
+        }
+    }
+
+  private:
+    std::vector<std::thread> threads_;
+};
+} // namespace utils
+
+#endif // UTILS_JOINING_THREADS_HPP
@@ -0,0 +1,394 @@
+#include "la/big_int.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace la {
+namespace {
+using Limbs = std::vector<std::uint32_t>;
+
+constexpr std::uint64_t kBase = std::uint64_t{1} << 32;
+
+void trim_limbs(Limbs &a) {
+    while (!a.empty() && a.back() == 0) {
+        a.pop_back();
+    }
+}
+
+int compare_mag(const Limbs &a, const Limbs &b) {
+    if (a.size() != b.size()) {
+        return a.size() < b.size() ? -1 : 1;
+    }
+    for (std::size_t i = a.size(); i-- > 0;) {
+        if (a[i] != b[i]) {
+            return a[i] < b[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+Limbs add_mag(const Limbs &a, const Limbs &b) {
+    const Limbs &lo = a.size() < b.size() ? a : b;
+    const Limbs &hi = a.size() < b.size() ? b : a;
+    Limbs sum(hi.size() + 1);
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < hi.size(); ++i) {
+        const std::uint64_t s =
+            std::uint64_t{hi[i]} + (i < lo.size() ? lo[i] : 0) + carry;
+        sum[i] = static_cast<std::uint32_t>(s);
+        carry = s >> 32;
+    }
+    sum[hi.size()] = static_cast<std::uint32_t>(carry);
+    trim_limbs(sum);
+    return sum;
+}
+
+// a - b for |a| >= |b|.
+Limbs sub_mag(const Limbs &a, const Limbs &b) {
+    Limbs diff(a.size());
+    std::int64_t borrow = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        std::int64_t d = std::int64_t{a[i]} - borrow -
+                         (i < b.size() ? std::int64_t{b[i]} : 0);
+        borrow = d < 0 ? 1 : 0;
+        diff[i] = static_cast<std::uint32_t>(d + (borrow ? kBase : 0));
+    }
+    trim_limbs(diff);
+    return diff;
+}
+
+Limbs mul_mag(const Limbs &a, const Limbs &b) {
+    if (a.empty() || b.empty()) {
+        return Limbs();
+    }
+    Limbs prod(a.size() + b.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        std::uint64_t carry = 0;
+        const std::uint64_t ai = a[i];
+        for (std::size_t j = 0; j < b.size(); ++j) {
+            const std::uint64_t t = ai * b[j] + prod[i + j] + carry;
+            prod[i + j] = static_cast<std::uint32_t>(t);
+            carry = t >> 32;
+        }
+        prod[i + b.size()] = static_cast<std::uint32_t>(carry);
+    }
+    trim_limbs(prod);
+    return prod;
+}
+
+// q = u / d, returns u % d, for a single-limb divisor.
+std::uint32_t divmod_small(const Limbs &u, std::uint32_t d, Limbs &q) {
+    q.assign(u.size(), 0);
+    std::uint64_t rem = 0;
+    for (std::size_t i = u.size(); i-- > 0;) {
+        const std::uint64_t cur = (rem << 32) | u[i];
+        q[i] = static_cast<std::uint32_t>(cur / d);
+        rem = cur % d;
+    }
+    trim_limbs(q);
+    return static_cast<std::uint32_t>(rem);
+}
+
+int leading_zeros(std::uint32_t x) {
+    int n = 0;
+    while (!(x & 0x80000000u)) {
+        x <<= 1;
+        ++n;
+    }
+    return n;
+}
+
+// Knuth, TAOCP vol. 2, 4.3.1, Algorithm D: q = u / v, r = u % v, with v
+// having at least two limbs.
+void divmod_knuth(const Limbs &u, const Limbs &v, Limbs &q, Limbs &r) {
+    const std::size_t n = v.size();
+    const std::size_t m = u.size() - n;
+    const int s = leading_zeros(v.back());
+
+    // Normalize so the top limb of the divisor has its high bit set.
+    Limbs vn(n);
+    Limbs un(u.size() + 1);
+    for (std::size_t i = n; i-- > 0;) {
+        vn[i] = (v[i] << s) |
+                (s && i > 0 ? static_cast<std::uint32_t>(
+                                  std::uint64_t{v[i - 1]} >> (32 - s))
+                            : 0);
+    }
+    un[u.size()] = s ? static_cast<std::uint32_t>(
+                           std::uint64_t{u.back()} >> (32 - s))
+                     : 0;
+    for (std::size_t i = u.size(); i-- > 0;) {
+        un[i] = (u[i] << s) |
+                (s && i > 0 ? static_cast<std::uint32_t>(
+                                  std::uint64_t{u[i - 1]} >> (32 - s))
+                            : 0);
+    }
+
+    q.assign(m + 1, 0);
+    for (std::size_t j = m + 1; j-- > 0;) {
+        const std::uint64_t num =
+            (std::uint64_t{un[j + n]} << 32) | un[j + n - 1];
+        std::uint64_t qhat = num / vn[n - 1];
+        std::uint64_t rhat = num % vn[n - 1];
+        while (qhat >= kBase ||
+               qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+            --qhat;
+            rhat += vn[n - 1];
+            if (rhat >= kBase)
+                break;
+        }
+
+        // un[j .. j+n] -= qhat * vn
+        std::int64_t borrow = 0;
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::uint64_t p = qhat * vn[i] + carry;
+            carry = p >> 32;
+            const std::int64_t t = std::int64_t{un[i + j]} -
+                                   static_cast<std::int64_t>(p & 0xffffffffu) -
+                                   borrow;
+            un[i + j] = static_cast<std::uint32_t>(t);
+            borrow = t < 0 ? 1 : 0;
+        }
+        const std::int64_t t = std::int64_t{un[j + n]} -
+                               static_cast<std::int64_t>(carry) - borrow;
+        un[j + n] = static_cast<std::uint32_t>(t);
+
+        if (t < 0) {
+            // qhat was one too large: add the divisor back.
+            --qhat;
+            std::uint64_t c = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const std::uint64_t sum = std::uint64_t{un[i + j]} + vn[i] + c;
+                un[i + j] = static_cast<std::uint32_t>(sum);
+                c = sum >> 32;
+            }
+            un[j + n] += static_cast<std::uint32_t>(c);
+        }
+        q[j] = static_cast<std::uint32_t>(qhat);
+    }
+
+    r.assign(n, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = (un[i] >> s) |
+               (s ? static_cast<std::uint32_t>(std::uint64_t{un[i + 1]}
+                                               << (32 - s))
+                  : 0);
+    }
+    trim_limbs(q);
+    trim_limbs(r);
+}
+
+void divmod_mag(const Limbs &u, const Limbs &v, Limbs &q, Limbs &r) {
+    if (compare_mag(u, v) < 0) {
+        q.clear();
+        r = u;
+    } else if (v.size() == 1) {
+        const std::uint32_t rem = divmod_small(u, v[0], q);
+        r.assign(rem ? 1 : 0, rem);
+    } else {
+        divmod_knuth(u, v, q, r);
+    }
+}
+} // namespace
+
+BigInt::BigInt(long long v) : neg_(v < 0) {
+    // Negate in unsigned arithmetic so LLONG_MIN does not overflow.
+    unsigned long long m = neg_ ? 0ull - static_cast<unsigned long long>(v)
+                                : static_cast<unsigned long long>(v);
+    while (m) {
+        mag_.push_back(static_cast<std::uint32_t>(m));
+        m >>= 32;
+    }
+}
+
+BigInt::BigInt(const std::string &s) {
+    std::size_t i = 0;
+    bool neg = false;
+    if (i < s.size() && (s[i] == '+' || s[i] == '-')) {
+        neg = s[i] == '-';
+        ++i;
+    }
+    if (i == s.size()) {
+        throw std::invalid_argument("BigInt: not a decimal integer");
+    }
+    for (; i < s.size(); ++i) {
+        if (s[i] < '0' || s[i] > '9') {
+            throw std::invalid_argument("BigInt: not a decimal integer");
+        }
+        // *this = *this * 10 + digit, limb by limb.
+        std::uint64_t carry = static_cast<std::uint64_t>(s[i] - '0');
+        for (std::uint32_t &limb : mag_) {
+            const std::uint64_t t = std::uint64_t{limb} * 10 + carry;
+            limb = static_cast<std::uint32_t>(t);
+            carry = t >> 32;
+        }
+        if (carry) {
+            mag_.push_back(static_cast<std::uint32_t>(carry));
+        }
+    }
+    neg_ = neg;
+    trim();
+}
+
+void BigInt::trim() noexcept {
+    trim_limbs(mag_);
+    if (mag_.empty()) {
+        neg_ = false;
+    }
+}
+
+std::size_t BigInt::bit_length() const noexcept {
+    if (mag_.empty()) {
+        return 0;
+    }
+    return 32 * mag_.size() - static_cast<std::size_t>(
+                                  leading_zeros(mag_.back()));
+}
+
+bool BigInt::fits_int64() const noexcept {
+    if (mag_.size() <= 1) {
+        return true;
+    }
+    if (mag_.size() > 2) {
+        return false;
+    }
+    const std::uint64_t m = (std::uint64_t{mag_[1]} << 32) | mag_[0];
+    return neg_ ? m <= (std::uint64_t{1} << 63) : m < (std::uint64_t{1} << 63);
+}
+
+long long BigInt::to_int64() const {
+    if (!fits_int64()) {
+        throw std::out_of_range("BigInt::to_int64: value does not fit");
+    }
+    std::uint64_t m = 0;
+    for (std::size_t i = mag_.size(); i-- > 0;) {
+        m = (m << 32) | mag_[i];
+    }
+    // Two's complement wrap-around gives LLONG_MIN for -2^63.
+    return neg_ ? static_cast<long long>(0ull - m) : static_cast<long long>(m);
+}
+
+double BigInt::to_double() const noexcept {
+    double d = 0.0;
+    for (std::size_t i = mag_.size(); i-- > 0;) {
+        d = d * 4294967296.0 + mag_[i];
+    }
+    return neg_ ? -d : d;
+}
+
+std::string BigInt::to_string() const {
+    if (mag_.empty()) {
+        return "0";
+    }
+    // Peel off nine decimal digits at a time.
+    std::string digits;
+    Limbs cur = mag_;
+    Limbs q;
+    while (!cur.empty()) {
+        std::uint32_t chunk = divmod_small(cur, 1000000000u, q);
+        cur.swap(q);
+        for (int k = 0; k < 9; ++k) {
+            digits.push_back(static_cast<char>('0' + chunk % 10));
+            chunk /= 10;
+            if (cur.empty() && chunk == 0)
+                break;
+        }
+    }
+    if (neg_) {
+        digits.push_back('-');
+    }
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+std::uint32_t BigInt::mod(std::uint32_t m) const {
+    if (m == 0) {
+        throw std::domain_error("BigInt::mod: modulus is zero");
+    }
+    std::uint64_t rem = 0;
+    for (std::size_t i = mag_.size(); i-- > 0;) {
+        rem = ((rem << 32) | mag_[i]) % m;
+    }
+    return neg_ && rem ? static_cast<std::uint32_t>(m - rem)
+                       : static_cast<std::uint32_t>(rem);
+}
+
+BigInt BigInt::operator-() const {
+    BigInt r = *this;
+    if (!r.mag_.empty()) {
+        r.neg_ = !r.neg_;
+    }
+    return r;
+}
+
+BigInt &BigInt::operator+=(const BigInt &b) {
+    if (neg_ == b.neg_) {
+        mag_ = add_mag(mag_, b.mag_);
+    } else if (compare_mag(mag_, b.mag_) >= 0) {
+        mag_ = sub_mag(mag_, b.mag_);
+    } else {
+        mag_ = sub_mag(b.mag_, mag_);
+        neg_ = b.neg_;
+    }
+    trim();
+    return *this;
+}
+
+BigInt &BigInt::operator-=(const BigInt &b) { return *this += -b; }
+
+BigInt &BigInt::operator*=(const BigInt &b) {
+    mag_ = mul_mag(mag_, b.mag_);
+    neg_ = neg_ != b.neg_;
+    trim();
+    return *this;
+}
+
+void BigInt::divmod(const BigInt &a, const BigInt &b, BigInt &q, BigInt &r) {
+    if (b.is_zero()) {
+        throw std::domain_error("BigInt: division by zero");
+    }
+    Limbs qm, rm;
+    divmod_mag(a.mag_, b.mag_, qm, rm);
+    const bool q_neg = a.neg_ != b.neg_;
+    const bool r_neg = a.neg_;
+    q.mag_ = std::move(qm);
+    q.neg_ = q_neg;
+    q.trim();
+    r.mag_ = std::move(rm);
+    r.neg_ = r_neg;
+    r.trim();
+}
+
+BigInt &BigInt::operator/=(const BigInt &b) {
+    BigInt r;
+    divmod(*this, b, *this, r);
+    return *this;
+}
+
+BigInt &BigInt::operator%=(const BigInt &b) {
+    BigInt q;
+    divmod(*this, b, q, *this);
+    return *this;
+}
+
+bool operator<(const BigInt &a, const BigInt &b) noexcept {
+    if (a.neg_ != b.neg_) {
+        return a.neg_;
+    }
+    const int c = compare_mag(a.mag_, b.mag_);
+    return a.neg_ ? c > 0 : c < 0;
+}
+
+BigInt abs(BigInt a) { return a.sign() < 0 ? -a : a; }
+
+BigInt gcd(BigInt a, BigInt b) {
+    a = abs(std::move(a));
+    b = abs(std::move(b));
+    while (!b.is_zero()) {
+        a %= b;
+        std::swap(a, b);
+    }
+    return a;
+}
+} // namespace la
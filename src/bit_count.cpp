@@ -0,0 +1,371 @@
+#include "la/bit_count.hpp"
+#include <algorithm>
+#include <atomic>
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                             \
+    (defined(__x86_64__) || defined(__i386__))
+#define LA_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LA_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define LA_ALWAYS_INLINE inline
+#endif
+
+namespace la {
+namespace {
+// Per-word counts.  HardwarePop uses the compiler builtin, which becomes
+// the POPCNT instruction once inlined into a function compiled for it.
+struct PortablePop {
+    static LA_ALWAYS_INLINE unsigned word(std::uint64_t x) noexcept {
+        x = x - ((x >> 1) & 0x5555555555555555ull);
+        x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+        x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return static_cast<unsigned>((x * 0x0101010101010101ull) >> 56);
+    }
+};
+
+#ifdef LA_X86_DISPATCH
+struct HardwarePop {
+    static LA_ALWAYS_INLINE unsigned word(std::uint64_t x) noexcept {
+        return static_cast<unsigned>(__builtin_popcountll(x));
+    }
+};
+#endif
+
+// The loops shared by the scalar kernels.  They are always inlined, so
+// each kernel below is compiled with its own target's instructions.
+template <typename Pop> struct Loops {
+    static LA_ALWAYS_INLINE std::size_t count(const std::uint64_t *w,
+                                              std::size_t n) noexcept {
+        std::size_t c = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            c += Pop::word(w[i]);
+        }
+        return c;
+    }
+
+    static LA_ALWAYS_INLINE std::size_t
+    xor_count(const std::uint64_t *a, const std::uint64_t *b,
+              std::size_t n) noexcept {
+        std::size_t c = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            c += Pop::word(a[i] ^ b[i]);
+        }
+        return c;
+    }
+
+    static LA_ALWAYS_INLINE void record_counts(const std::uint64_t *w,
+                                               std::size_t count,
+                                               std::size_t rw,
+                                               std::uint32_t *out) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<std::uint32_t>(Loops::count(w + i * rw, rw));
+        }
+    }
+
+    // out[j] = distance between a and record j.
+    static LA_ALWAYS_INLINE void
+    row_distances(const std::uint64_t *a, const std::uint64_t *records,
+                  std::size_t count, std::size_t rw,
+                  std::uint32_t *out) noexcept {
+        for (std::size_t j = 0; j < count; ++j) {
+            out[j] = static_cast<std::uint32_t>(
+                xor_count(a, records + j * rw, rw));
+        }
+    }
+};
+
+struct Kernels {
+    PopcountKernel kind;
+    std::size_t (*count)(const std::uint64_t *, std::size_t);
+    std::size_t (*xor_count)(const std::uint64_t *, const std::uint64_t *,
+                             std::size_t);
+    void (*record_counts)(const std::uint64_t *, std::size_t, std::size_t,
+                          std::uint32_t *);
+    void (*row_distances)(const std::uint64_t *, const std::uint64_t *,
+                          std::size_t, std::size_t, std::uint32_t *);
+};
+
+std::size_t count_portable(const std::uint64_t *w, std::size_t n) {
+    return Loops<PortablePop>::count(w, n);
+}
+
+std::size_t xor_count_portable(const std::uint64_t *a, const std::uint64_t *b,
+                               std::size_t n) {
+    return Loops<PortablePop>::xor_count(a, b, n);
+}
+
+void record_counts_portable(const std::uint64_t *w, std::size_t count,
+                            std::size_t rw, std::uint32_t *out) {
+    Loops<PortablePop>::record_counts(w, count, rw, out);
+}
+
+void row_distances_portable(const std::uint64_t *a,
+                            const std::uint64_t *records, std::size_t count,
+                            std::size_t rw, std::uint32_t *out) {
+    Loops<PortablePop>::row_distances(a, records, count, rw, out);
+}
+
+const Kernels kPortable = {PopcountKernel::Portable, count_portable,
+                           xor_count_portable, record_counts_portable,
+                           row_distances_portable};
+
+#ifdef LA_X86_DISPATCH
+#define LA_TARGET_POPCNT __attribute__((target("popcnt")))
+#define LA_TARGET_AVX512                                                     \
+    __attribute__((target("popcnt,avx512f,avx512vpopcntdq")))
+
+LA_TARGET_POPCNT std::size_t count_popcnt(const std::uint64_t *w,
+                                          std::size_t n) {
+    return Loops<HardwarePop>::count(w, n);
+}
+
+LA_TARGET_POPCNT std::size_t xor_count_popcnt(const std::uint64_t *a,
+                                              const std::uint64_t *b,
+                                              std::size_t n) {
+    return Loops<HardwarePop>::xor_count(a, b, n);
+}
+
+LA_TARGET_POPCNT void record_counts_popcnt(const std::uint64_t *w,
+                                           std::size_t count, std::size_t rw,
+                                           std::uint32_t *out) {
+    Loops<HardwarePop>::record_counts(w, count, rw, out);
+}
+
+LA_TARGET_POPCNT void row_distances_popcnt(const std::uint64_t *a,
+                                           const std::uint64_t *records,
+                                           std::size_t count, std::size_t rw,
+                                           std::uint32_t *out) {
+    Loops<HardwarePop>::row_distances(a, records, count, rw, out);
+}
+
+const Kernels kPopcnt = {PopcountKernel::Popcnt, count_popcnt,
+                         xor_count_popcnt, record_counts_popcnt,
+                         row_distances_popcnt};
+
+// Sum of the eight lanes.  _mm512_reduce_add_epi64 and the unmasked
+// _mm512_cvtepi64_epi32 are avoided: GCC 12 implements them with an
+// uninitialised source operand and warns about it at -O2.
+LA_TARGET_AVX512 std::uint64_t sum_lanes(__m512i x) {
+    std::uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, x);
+    std::uint64_t sum = 0;
+    for (std::uint64_t v : lanes) {
+        sum += v;
+    }
+    return sum;
+}
+
+// The eight 64-bit lanes of x narrowed to 32 bits.
+LA_TARGET_AVX512 __m256i narrow_lanes(__m512i x) {
+    return _mm512_maskz_cvtepi64_epi32(0xFF, x);
+}
+
+// Eight words per VPOPCNTQ; a masked load picks up the last n % 8 words.
+LA_TARGET_AVX512 std::size_t count_avx512(const std::uint64_t *w,
+                                          std::size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i x = _mm512_loadu_si512(w + i);
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+    }
+    if (i < n) {
+        const __mmask8 m = static_cast<__mmask8>((1u << (n - i)) - 1);
+        const __m512i x = _mm512_maskz_loadu_epi64(m, w + i);
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+    }
+    return static_cast<std::size_t>(sum_lanes(acc));
+}
+
+LA_TARGET_AVX512 std::size_t xor_count_avx512(const std::uint64_t *a,
+                                              const std::uint64_t *b,
+                                              std::size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i x = _mm512_xor_si512(_mm512_loadu_si512(a + i),
+                                           _mm512_loadu_si512(b + i));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+    }
+    if (i < n) {
+        const __mmask8 m = static_cast<__mmask8>((1u << (n - i)) - 1);
+        const __m512i x = _mm512_xor_si512(_mm512_maskz_loadu_epi64(m, a + i),
+                                           _mm512_maskz_loadu_epi64(m, b + i));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+    }
+    return static_cast<std::size_t>(sum_lanes(acc));
+}
+
+// Single-word records are counted eight at a time; longer ones one record
+// per call of the block kernel.
+LA_TARGET_AVX512 void record_counts_avx512(const std::uint64_t *w,
+                                           std::size_t count, std::size_t rw,
+                                           std::uint32_t *out) {
+    std::size_t i = 0;
+    if (rw == 1) {
+        for (; i + 8 <= count; i += 8) {
+            const __m512i c = _mm512_popcnt_epi64(_mm512_loadu_si512(w + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                                narrow_lanes(c));
+        }
+    }
+    for (; i < count; ++i) {
+        out[i] = static_cast<std::uint32_t>(count_avx512(w + i * rw, rw));
+    }
+}
+
+LA_TARGET_AVX512 void row_distances_avx512(const std::uint64_t *a,
+                                           const std::uint64_t *records,
+                                           std::size_t count, std::size_t rw,
+                                           std::uint32_t *out) {
+    std::size_t j = 0;
+    if (rw == 1) {
+        const __m512i x = _mm512_set1_epi64(static_cast<long long>(a[0]));
+        for (; j + 8 <= count; j += 8) {
+            const __m512i d =
+                _mm512_xor_si512(x, _mm512_loadu_si512(records + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + j),
+                                narrow_lanes(_mm512_popcnt_epi64(d)));
+        }
+    }
+    for (; j < count; ++j) {
+        out[j] = static_cast<std::uint32_t>(
+            xor_count_avx512(a, records + j * rw, rw));
+    }
+}
+
+const Kernels kAvx512 = {PopcountKernel::Avx512, count_avx512,
+                         xor_count_avx512, record_counts_avx512,
+                         row_distances_avx512};
+#endif
+
+// The kernels for k, or null if this CPU or build lacks them.
+const Kernels *kernels_for(PopcountKernel k) noexcept {
+#ifdef LA_X86_DISPATCH
+    __builtin_cpu_init();
+    switch (k) {
+    case PopcountKernel::Avx512:
+        return __builtin_cpu_supports("avx512f") &&
+                       __builtin_cpu_supports("avx512vpopcntdq")
+                   ? &kAvx512
+                   : nullptr;
+    case PopcountKernel::Popcnt:
+        return __builtin_cpu_supports("popcnt") ? &kPopcnt : nullptr;
+    case PopcountKernel::Portable:
+        return &kPortable;
+    }
+    return nullptr;
+#else
+    return k == PopcountKernel::Portable ? &kPortable : nullptr;
+#endif
+}
+
+// The fastest kernels this CPU supports.
+const Kernels *best_kernels() noexcept {
+    for (PopcountKernel k : {PopcountKernel::Avx512, PopcountKernel::Popcnt}) {
+        if (const Kernels *p = kernels_for(k)) {
+            return p;
+        }
+    }
+    return &kPortable;
+}
+
+std::atomic<const Kernels *> &active() noexcept {
+    static std::atomic<const Kernels *> kernels{best_kernels()};
+    return kernels;
+}
+
+const Kernels &kernels() noexcept {
+    return *active().load(std::memory_order_relaxed);
+}
+
+bool fold_parity(const std::uint64_t *w, std::size_t n) noexcept {
+    std::uint64_t x = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        x ^= w[i];
+    }
+    return popcount(x) & 1;
+}
+} // namespace
+
+PopcountKernel popcount_kernel() noexcept { return kernels().kind; }
+
+bool set_popcount_kernel(PopcountKernel k) noexcept {
+    const Kernels *p = kernels_for(k);
+    if (!p) {
+        return false;
+    }
+    active().store(p, std::memory_order_relaxed);
+    return true;
+}
+
+std::size_t popcount(const std::uint64_t *w, std::size_t n) noexcept {
+    return kernels().count(w, n);
+}
+
+bool parity(const std::uint64_t *w, std::size_t n) noexcept {
+    return fold_parity(w, n);
+}
+
+std::size_t hamming_distance(const std::uint64_t *a, const std::uint64_t *b,
+                             std::size_t n) noexcept {
+    return kernels().xor_count(a, b, n);
+}
+
+void record_weights(const std::uint64_t *w, std::size_t count,
+                    std::size_t record_words,
+                    std::vector<std::uint32_t> &weights) {
+    weights.assign(count, 0);
+    kernels().record_counts(w, count, record_words, weights.data());
+}
+
+void record_parities(const std::uint64_t *w, std::size_t count,
+                     std::size_t record_words, BitVector &parities) {
+    // XOR-folding a record to one word leaves its parity unchanged, so
+    // only one word per record is counted.
+    parities = BitVector(count);
+    std::uint64_t *out = parities.data();
+    for (std::size_t base = 0; base < count; base += 64) {
+        const std::size_t end = std::min(count, base + 64);
+        std::uint64_t word = 0;
+        for (std::size_t i = base; i < end; ++i) {
+            const bool p = fold_parity(w + i * record_words, record_words);
+            word |= std::uint64_t{p} << (i - base);
+        }
+        out[base / 64] = word;
+    }
+}
+
+void pairwise_hamming_distances(const std::uint64_t *w, std::size_t count,
+                                std::size_t record_words,
+                                std::vector<std::uint32_t> &distances) {
+    // Row i is computed right of the diagonal and mirrored below it.
+    distances.assign(count * count, 0);
+    const Kernels &k = kernels();
+    std::uint32_t *d = distances.data();
+    for (std::size_t i = 0; i + 1 < count; ++i) {
+        std::uint32_t *row = d + i * count;
+        k.row_distances(w + i * record_words, w + (i + 1) * record_words,
+                        count - i - 1, record_words, row + i + 1);
+        for (std::size_t j = i + 1; j < count; ++j) {
+            d[j * count + i] = row[j];
+        }
+    }
+}
+
+BitVector row_parities(const BitMatrix &A) {
+    BitVector p;
+    record_parities(A.row_data(0), A.rows(), A.stride(), p);
+    return p;
+}
+
+std::vector<std::uint32_t> pairwise_hamming_distances(const BitMatrix &A) {
+    std::vector<std::uint32_t> d;
+    pairwise_hamming_distances(A.row_data(0), A.rows(), A.stride(), d);
+    return d;
+}
+} // namespace la
@@ -0,0 +1,284 @@
+#include "la/bit_matrix.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace la {
+namespace {
+// Columns per M4RI strip; the lookup table has 2^kStrip rows.
+constexpr std::size_t kStrip = 8;
+
+// dst[w0, stride) ^= src[w0, stride)
+void xor_words(std::uint64_t *dst, const std::uint64_t *src, std::size_t w0,
+               std::size_t stride) {
+    for (std::size_t w = w0; w < stride; ++w) {
+        dst[w] ^= src[w];
+    }
+}
+} // namespace
+
+BitVector::BitVector(std::initializer_list<int> bits)
+    : BitVector(bits.size()) {
+    std::size_t j = 0;
+    for (int b : bits) {
+        set(j++, b != 0);
+    }
+}
+
+std::size_t BitVector::weight() const noexcept {
+    std::size_t n = 0;
+    for (std::uint64_t w : words_) {
+        n += static_cast<std::size_t>(popcount(w));
+    }
+    return n;
+}
+
+BitVector &BitVector::operator^=(const BitVector &other) {
+    if (other.n_ != n_) {
+        throw std::invalid_argument("BitVector: sizes must match");
+    }
+    xor_words(words_.data(), other.words_.data(), 0, words_.size());
+    return *this;
+}
+
+BitMatrix::BitMatrix(std::size_t rows, std::size_t cols,
+                     std::initializer_list<int> bits)
+    : BitMatrix(rows, cols) {
+    if (bits.size() != rows * cols) {
+        throw std::invalid_argument(
+            "BitMatrix: number of bits must match rows * cols");
+    }
+    auto it = bits.begin();
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            set(i, j, *it++ != 0);
+        }
+    }
+}
+
+bool BitMatrix::at(std::size_t i, std::size_t j) const {
+    if (i >= rows_ || j >= cols_) {
+        throw std::out_of_range("BitMatrix::at: index out of range");
+    }
+    return (*this)(i, j);
+}
+
+BitVector BitMatrix::row(std::size_t i) const {
+    BitVector v(cols_);
+    std::copy(row_data(i), row_data(i) + stride_, v.data());
+    return v;
+}
+
+void BitMatrix::exchange_rows(std::size_t a, std::size_t b) noexcept {
+    if (a != b) {
+        std::swap_ranges(row_data(a), row_data(a) + stride_, row_data(b));
+    }
+}
+
+std::size_t BitMatrix::row_weight(std::size_t i) const noexcept {
+    const std::uint64_t *r = row_data(i);
+    std::size_t n = 0;
+    for (std::size_t w = 0; w < stride_; ++w) {
+        n += static_cast<std::size_t>(popcount(r[w]));
+    }
+    return n;
+}
+
+BitMatrix bit_identity(std::size_t n) {
+    BitMatrix I(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        I.set(i, i);
+    }
+    return I;
+}
+
+BitMatrix transpose(const BitMatrix &A) {
+    BitMatrix T(A.cols(), A.rows());
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            if (A(i, j)) {
+                T.set(j, i);
+            }
+        }
+    }
+    return T;
+}
+
+BitVector operator*(const BitMatrix &A, const BitVector &x) {
+    if (x.size() != A.cols()) {
+        throw std::invalid_argument(
+            "BitMatrix * BitVector: size of x must match columns of A");
+    }
+    BitVector y(A.rows());
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        const std::uint64_t *r = A.row_data(i);
+        std::uint64_t acc = 0;
+        for (std::size_t w = 0; w < A.stride(); ++w) {
+            acc ^= r[w] & x.data()[w];
+        }
+        y.set(i, popcount(acc) % 2 != 0);
+    }
+    return y;
+}
+
+BitMatrix operator*(const BitMatrix &A, const BitMatrix &B) {
+    if (A.cols() != B.rows()) {
+        throw std::invalid_argument(
+            "BitMatrix product: columns of A must match rows of B");
+    }
+    // Row i of AB is the sum of the rows of B selected by row i of A.
+    BitMatrix C(A.rows(), B.cols());
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        std::uint64_t *c = C.row_data(i);
+        for (std::size_t k = 0; k < A.cols(); ++k) {
+            if (A(i, k)) {
+                xor_words(c, B.row_data(k), 0, C.stride());
+            }
+        }
+    }
+    return C;
+}
+
+PivotInfo rref_inplace(BitMatrix &A) {
+    const std::size_t m = A.rows();
+    const std::size_t n = A.cols();
+    const std::size_t stride = A.stride();
+    PivotInfo info;
+
+    // table[g] = sum of the strip's pivot rows selected by the bits of g,
+    // from the strip's first word on (everything left of it is zero).
+    std::vector<std::uint64_t> table((std::size_t{1} << kStrip) * stride);
+    std::size_t strip_cols[kStrip];
+
+    std::size_t r = 0;
+    std::size_t c = 0;
+    while (r < m && c < n) {
+        // 1. Find up to kStrip pivots in the columns from c on, reducing
+        // each candidate row against the strip's pivots found so far.
+        // Rows r and below are zero left of column c.
+        std::size_t found = 0;
+        for (; c < n && found < kStrip && r + found < m; ++c) {
+            std::size_t piv = m;
+            for (std::size_t i = r + found; i < m && piv == m; ++i) {
+                for (std::size_t k = 0; k < found; ++k) {
+                    if (A(i, strip_cols[k])) {
+                        A.xor_rows(i, r + k);
+                    }
+                }
+                if (A(i, c)) {
+                    piv = i;
+                }
+            }
+            if (piv == m) {
+                continue;
+            }
+            A.exchange_rows(r + found, piv);
+            // Keep the strip's pivot rows reduced against each other.
+            for (std::size_t k = 0; k < found; ++k) {
+                if (A(r + k, c)) {
+                    A.xor_rows(r + k, r + found);
+                }
+            }
+            strip_cols[found++] = c;
+            info.pivot_cols.push_back(c);
+        }
+        if (found == 0) {
+            break;
+        }
+
+        // 2. Tabulate all 2^found sums of the pivot rows in Gray code
+        // order, one row XOR per entry.
+        const std::size_t w0 = strip_cols[0] / 64;
+        const std::size_t entries = std::size_t{1} << found;
+        std::fill(table.begin(), table.begin() + stride, 0);
+        for (std::size_t g = 1; g < entries; ++g) {
+            const std::size_t gray = g ^ (g >> 1);
+            const std::size_t prev = (g - 1) ^ ((g - 1) >> 1);
+            std::size_t bit = 0;
+            while (!(((gray ^ prev) >> bit) & 1u)) {
+                ++bit;
+            }
+            std::uint64_t *dst = table.data() + gray * stride;
+            const std::uint64_t *src = table.data() + prev * stride;
+            const std::uint64_t *piv_row = A.row_data(r + bit);
+            for (std::size_t w = w0; w < stride; ++w) {
+                dst[w] = src[w] ^ piv_row[w];
+            }
+        }
+
+        // 3. Clear the strip's pivot columns from every other row with one
+        // lookup and one XOR.
+        for (std::size_t i = 0; i < m; ++i) {
+            if (i >= r && i < r + found)
+                continue;
+            std::size_t g = 0;
+            for (std::size_t k = 0; k < found; ++k) {
+                g |= static_cast<std::size_t>(A(i, strip_cols[k])) << k;
+            }
+            if (g != 0) {
+                xor_words(A.row_data(i), table.data() + g * stride, w0,
+                          stride);
+            }
+        }
+        r += found;
+    }
+
+    std::size_t next = 0;
+    for (std::size_t j = 0; j < n; ++j) {
+        if (next < info.pivot_cols.size() && info.pivot_cols[next] == j) {
+            ++next;
+        } else {
+            info.free_cols.push_back(j);
+        }
+    }
+    return info;
+}
+
+std::size_t rank(const BitMatrix &A) {
+    BitMatrix R = A;
+    return rref_inplace(R).pivot_cols.size();
+}
+
+bool solve(const BitMatrix &A, const BitVector &b, BitVector &x) {
+    const std::size_t m = A.rows();
+    const std::size_t n = A.cols();
+    if (b.size() != m) {
+        throw std::invalid_argument(
+            "Size of b must match number of rows in A");
+    }
+
+    BitMatrix Ab(m, n + 1);
+    for (std::size_t i = 0; i < m; ++i) {
+        std::copy(A.row_data(i), A.row_data(i) + A.stride(), Ab.row_data(i));
+        Ab.set(i, n, b[i]);
+    }
+    const PivotInfo info = rref_inplace(Ab);
+    if (!info.pivot_cols.empty() && info.pivot_cols.back() == n) {
+        return false; // a pivot in the RHS column: 0 = 1
+    }
+
+    BitVector sol(n);
+    for (std::size_t i = 0; i < info.pivot_cols.size(); ++i) {
+        sol.set(info.pivot_cols[i], Ab(i, n));
+    }
+    x = sol;
+    return true;
+}
+
+BitMatrix null_space(const BitMatrix &A) {
+    BitMatrix R = A;
+    const PivotInfo info = rref_inplace(R);
+
+    // Free variable f set to 1, each pivot variable to R(i, f).
+    BitMatrix N(info.free_cols.size(), A.cols());
+    for (std::size_t k = 0; k < info.free_cols.size(); ++k) {
+        const std::size_t f = info.free_cols[k];
+        N.set(k, f);
+        for (std::size_t i = 0; i < info.pivot_cols.size(); ++i) {
+            if (R(i, f)) {
+                N.set(k, info.pivot_cols[i]);
+            }
+        }
+    }
+    return N;
+}
+} // namespace la
@@ -0,0 +1,44 @@
+#include "la/check_digits.hpp"
+
+namespace la {
+namespace detail {
+// Multiplication in the dihedral group D5.
+const unsigned char kVerhoeffMul[10][10] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, {1, 2, 3, 4, 0, 6, 7, 8, 9, 5},
+    {2, 3, 4, 0, 1, 7, 8, 9, 5, 6}, {3, 4, 0, 1, 2, 8, 9, 5, 6, 7},
+    {4, 0, 1, 2, 3, 9, 5, 6, 7, 8}, {5, 9, 8, 7, 6, 0, 4, 3, 2, 1},
+    {6, 5, 9, 8, 7, 1, 0, 4, 3, 2}, {7, 6, 5, 9, 8, 2, 1, 0, 4, 3},
+    {8, 7, 6, 5, 9, 3, 2, 1, 0, 4}, {9, 8, 7, 6, 5, 4, 3, 2, 1, 0}};
+
+// Powers of the position permutation (1 5 8 9 4 2 7 0)(3 6).
+const unsigned char kVerhoeffPerm[8][10] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, {1, 5, 7, 6, 2, 8, 3, 0, 9, 4},
+    {5, 8, 0, 3, 7, 9, 6, 1, 4, 2}, {8, 9, 1, 6, 0, 4, 3, 5, 2, 7},
+    {9, 4, 5, 3, 1, 2, 6, 8, 7, 0}, {4, 2, 8, 6, 5, 7, 3, 9, 0, 1},
+    {2, 7, 9, 3, 8, 0, 6, 4, 1, 5}, {7, 0, 4, 6, 9, 1, 3, 2, 5, 8}};
+
+// Inverses in D5.
+const unsigned char kVerhoeffInv[10] = {0, 4, 3, 2, 1, 5, 6, 7, 8, 9};
+
+void check_stride(std::size_t stride, std::size_t length) {
+    if (stride < length) {
+        throw std::invalid_argument("stride must be at least the code length");
+    }
+}
+
+std::size_t set_bit_indices(const BitVector &bits,
+                            std::vector<std::size_t> &indices) {
+    indices.clear();
+    const std::uint64_t *w = bits.data();
+    for (std::size_t k = 0; k < bits.words(); ++k) {
+        for (std::uint64_t word = w[k]; word; word &= word - 1) {
+            // popcount of the bits below the lowest set bit is its index.
+            indices.push_back(
+                64 * k +
+                static_cast<std::size_t>(popcount((word & (~word + 1)) - 1)));
+        }
+    }
+    return indices.size();
+}
+} // namespace detail
+} // namespace la
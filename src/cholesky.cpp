@@ -0,0 +1,262 @@
+#include "la/cholesky.hpp"
+#include "math_utils/math_utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace la {
+namespace {
+// A downdate whose new diagonal entry keeps less than this fraction of the
+// old one (squared) has cancelled too many digits; the changed matrix is
+// refactored instead.
+constexpr double kMinDowndateRatio = 1e-8;
+
+// L L^T = A by rows: each entry is a dot product of two contiguous rows of
+// the packed factor.  Returns false if A is not (numerically) positive
+// definite.
+bool factor_into(const SymmetricMatrix &A, TriangularMatrix &L) {
+    const std::size_t n = A.rows();
+    L = TriangularMatrix(n, Triangle::Lower);
+
+    double scale = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        scale = std::max(scale, std::fabs(A(i, i)));
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double *li = L.row_data(i);
+        for (std::size_t j = 0; j <= i; ++j) {
+            const double *lj = L.row_data(j);
+            double s = A(i, j);
+            for (std::size_t k = 0; k < j; ++k) {
+                s -= li[k] * lj[k];
+            }
+            if (j < i) {
+                li[j] = s / lj[j];
+            } else if (s <= 0.0 || math_utils::is_effectively_zero(s, scale)) {
+                return false;
+            } else {
+                li[i] = std::sqrt(s);
+            }
+        }
+    }
+    return true;
+}
+
+// L L^T + sign x x^T as a sequence of plane rotations on the columns of L
+// (sign = +1 update, -1 downdate).  x is consumed.  Returns false if a
+// downdate breaks down or cancels too much; L is then partially modified.
+bool rank_one_into(TriangularMatrix &L, Vector &x, double sign) {
+    const std::size_t n = L.rows();
+    for (std::size_t k = 0; k < n; ++k) {
+        double &lkk = L.row_data(k)[k];
+        const double r2 = lkk * lkk + sign * x[k] * x[k];
+        if (r2 <= kMinDowndateRatio * lkk * lkk) {
+            return false;
+        }
+        const double r = sign > 0.0 ? std::hypot(lkk, x[k]) : std::sqrt(r2);
+        const double c = r / lkk;
+        const double s = x[k] / lkk;
+        lkk = r;
+        for (std::size_t i = k + 1; i < n; ++i) {
+            double &lik = L.row_data(i)[k];
+            lik = (lik + sign * s * x[i]) / c;
+            x[i] = c * x[i] - s * lik;
+        }
+    }
+    return true;
+}
+
+// A += sign X X^T.
+void add_outer(SymmetricMatrix &A, const Matrix &X, double sign) {
+    for (std::size_t i = 0; i < X.rows(); ++i) {
+        for (std::size_t j = i; j < X.rows(); ++j) {
+            double s = 0.0;
+            for (std::size_t t = 0; t < X.cols(); ++t) {
+                s += X(i, t) * X(j, t);
+            }
+            A(i, j) += sign * s;
+        }
+    }
+}
+
+// Rank-one changes of L by the columns of X, x is scratch.  Stops at the
+// first one that fails and returns false.
+bool rank_k_into(TriangularMatrix &L, const Matrix &X, Vector &x,
+                 double sign) {
+    x.assign(X.rows());
+    for (std::size_t t = 0; t < X.cols(); ++t) {
+        for (std::size_t i = 0; i < X.rows(); ++i) {
+            x[i] = X(i, t);
+        }
+        if (!rank_one_into(L, x, sign)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// X := A^{-1} X for A = L L^T, combining whole rows of X.
+void solve_factored(const TriangularMatrix &L, Matrix &X) {
+    const std::size_t n = L.rows();
+    const std::size_t k = X.cols();
+    for (std::size_t i = 0; i < n; ++i) {
+        const double *li = L.row_data(i);
+        for (std::size_t j = 0; j < i; ++j) {
+            if (li[j] == 0.0)
+                continue;
+            for (std::size_t c = 0; c < k; ++c) {
+                X(i, c) -= li[j] * X(j, c);
+            }
+        }
+        for (std::size_t c = 0; c < k; ++c) {
+            X(i, c) /= li[i];
+        }
+    }
+    // L^T x = y: once x_i is known, row i of L holds its coefficients in
+    // all the equations above.
+    for (std::size_t i = n; i-- > 0;) {
+        const double *li = L.row_data(i);
+        for (std::size_t c = 0; c < k; ++c) {
+            X(i, c) /= li[i];
+        }
+        for (std::size_t j = 0; j < i; ++j) {
+            if (li[j] == 0.0)
+                continue;
+            for (std::size_t c = 0; c < k; ++c) {
+                X(j, c) -= li[j] * X(i, c);
+            }
+        }
+    }
+}
+} // namespace
+
+Cholesky::Cholesky(const SymmetricMatrix &A) : a_(A) {
+    if (!factor_into(a_, l_)) {
+        throw std::domain_error("Cholesky: matrix is not positive definite");
+    }
+}
+
+Cholesky::Cholesky(const Matrix &A) : Cholesky(SymmetricMatrix(A)) {}
+
+Vector Cholesky::solve(const Vector &b) const {
+    if (b.size() != size()) {
+        throw std::invalid_argument("Cholesky::solve: size of b must match A");
+    }
+    Matrix X(size(), std::size_t{1}, b);
+    solve_factored(l_, X);
+    return X.column(0);
+}
+
+Matrix Cholesky::solve(const Matrix &B) const {
+    if (B.rows() != size()) {
+        throw std::invalid_argument(
+            "Cholesky::solve: rows of B must match A");
+    }
+    Matrix X = B;
+    solve_factored(l_, X);
+    return X;
+}
+
+void Cholesky::solve(const Vector &b, Vector &x, Workspace &ws) const {
+    const std::size_t n = size();
+    if (b.size() != n) {
+        throw std::invalid_argument("Cholesky::solve: size of b must match A");
+    }
+    ws.reset();
+    Matrix &X = ws.matrix(n, 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        X(i, 0) = b[i];
+    }
+    solve_factored(l_, X);
+    x.assign(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = X(i, 0);
+    }
+}
+
+void Cholesky::solve(const Matrix &B, Matrix &X, Workspace &ws) const {
+    if (B.rows() != size()) {
+        throw std::invalid_argument(
+            "Cholesky::solve: rows of B must match A");
+    }
+    (void)ws; // X is solved in place, no scratch needed
+    X.assign(B.rows(), B.cols());
+    for (std::size_t i = 0; i < B.rows(); ++i) {
+        for (std::size_t c = 0; c < B.cols(); ++c) {
+            X(i, c) = B(i, c);
+        }
+    }
+    solve_factored(l_, X);
+}
+
+double Cholesky::determinant() const noexcept {
+    double det = 1.0;
+    for (std::size_t i = 0; i < size(); ++i) {
+        const double d = l_.row_data(i)[i];
+        det *= d * d;
+    }
+    return det;
+}
+
+void Cholesky::update(const Vector &x) {
+    if (x.size() != size()) {
+        throw std::invalid_argument(
+            "Cholesky::update: size of x must match A");
+    }
+    update(Matrix(size(), std::size_t{1}, x));
+}
+
+void Cholesky::update(const Matrix &X) {
+    Workspace ws;
+    update(X, ws);
+}
+
+void Cholesky::update(const Matrix &X, Workspace &ws) {
+    if (X.rows() != size()) {
+        throw std::invalid_argument(
+            "Cholesky::update: rows of X must match A");
+    }
+    // An update of a positive definite matrix cannot break down.
+    ws.reset();
+    rank_k_into(l_, X, ws.vector(size()), 1.0);
+    add_outer(a_, X, 1.0);
+}
+
+void Cholesky::downdate(const Vector &x) {
+    if (x.size() != size()) {
+        throw std::invalid_argument(
+            "Cholesky::downdate: size of x must match A");
+    }
+    downdate(Matrix(size(), std::size_t{1}, x));
+}
+
+void Cholesky::downdate(const Matrix &X) {
+    Workspace ws;
+    downdate(X, ws);
+}
+
+void Cholesky::downdate(const Matrix &X, Workspace &ws) {
+    if (X.rows() != size()) {
+        throw std::invalid_argument(
+            "Cholesky::downdate: rows of X must match A");
+    }
+    // L is downdated in place.  Only when that fails is A - X X^T built and
+    // refactored, and if that is not positive definite either, L is
+    // refactored from the unchanged A.
+    ws.reset();
+    if (rank_k_into(l_, X, ws.vector(size()), -1.0)) {
+        add_outer(a_, X, -1.0);
+        return;
+    }
+    SymmetricMatrix a = a_;
+    add_outer(a, X, -1.0);
+    if (!factor_into(a, l_)) {
+        factor_into(a_, l_);
+        throw std::domain_error(
+            "Cholesky::downdate: result is not positive definite");
+    }
+    a_ = std::move(a);
+}
+} // namespace la
@@ -1,6 +1,7 @@
 #include "la/matrix.hpp"
 #include "la/matrix_algorithms.hpp"
 #include <cassert>
+#include <cmath>
 
 namespace la {
 
@@ -25,4 +26,51 @@ double determinant(const Matrix &A) {
         "Determinant is not currently implemented for larger than 3x3 matrix");
 }
 
+double determinant(const Matrix &A, Workspace &ws) {
+    if (A.rows() != A.cols()) {
+        throw std::domain_error(
+            "Determinant is defined only for square matrix");
+    }
+    ws.reset();
+    Matrix &U = ws.copy(A);
+    const std::size_t n = U.rows();
+
+    double scale = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            scale = std::max(scale, std::fabs(U(i, j)));
+        }
+    }
+
+    // det(A) = (-1)^swaps * product of the pivots of U
+    double det = 1.0;
+    for (std::size_t k = 0; k < n; ++k) {
+        std::size_t p = k;
+        for (std::size_t i = k + 1; i < n; ++i) {
+            if (std::fabs(U(i, k)) > std::fabs(U(p, k))) {
+                p = i;
+            }
+        }
+        if (math_utils::is_effectively_zero(U(p, k), scale)) {
+            return 0.0;
+        }
+        if (p != k) {
+            U.exchange_rows(k, p);
+            det = -det;
+        }
+
+        const double pivot = U(k, k);
+        det *= pivot;
+        for (std::size_t i = k + 1; i < n; ++i) {
+            const double factor = U(i, k) / pivot;
+            if (factor == 0.0)
+                continue;
+            for (std::size_t j = k + 1; j < n; ++j) {
+                U(i, j) -= factor * U(k, j);
+            }
+        }
+    }
+    return det;
+}
+
 } // namespace la
@@ -3,20 +3,20 @@
 #include "la/matrix_algorithms.hpp"
 #include "la/vector.hpp"
 #include "math_utils/math_utils.hpp"
+#include <stdexcept>
+#include <utility>
 
 namespace la {
 
-bool is_inconsistent(const Matrix &R, const PivotInfo pivots) {
-    std::size_t m = R.rows();
-    std::size_t n = R.cols() - 1; // columns of coefficient matrix
-
-    // n = number of variables
+bool is_inconsistent(const Matrix &B, std::size_t col,
+                     const PivotInfo &pivots) {
+    std::size_t m = B.rows();
     std::size_t rank = pivots.pivot_cols.size();
 
     // In REF, a system is inconsistent iff there exists a row index i ≥ rank
     // such that the RHS entry of row i is nonzero.
     for (std::size_t i = rank; i < m; i++) {
-        if (!math_utils::nearly_equal(R(i, n), 0)) {
+        if (!math_utils::nearly_equal(B(i, col), 0)) {
             return true;
         }
     }
@@ -24,12 +24,37 @@ bool is_inconsistent(const Matrix &R, const PivotInfo pivots) {
     return false;
 }
 
+EliminationInfo eliminate_system_inplace(Matrix &Ab) {
+    EliminationInfo info;
+    info.inconsistent = eliminate_system_inplace(Ab, info.pivots);
+    return info;
+}
+
+bool eliminate_system_inplace(Matrix &Ab, PivotInfo &pivots) {
+    if (Ab.cols() == 0) {
+        throw std::invalid_argument(
+            "eliminate_system_inplace: augmented matrix needs a RHS column");
+    }
+    const std::size_t n = Ab.cols() - 1; // number of variables
+
+    // A pivot in the RHS column is not a variable; it shows up as an
+    // inconsistent row below.
+    ref_inplace(Ab, pivots);
+    if (!pivots.pivot_cols.empty() && pivots.pivot_cols.back() == n) {
+        pivots.pivot_cols.pop_back();
+    }
+    if (!pivots.free_cols.empty() && pivots.free_cols.back() == n) {
+        pivots.free_cols.pop_back();
+    }
+
+    return is_inconsistent(Ab, n, pivots);
+}
+
 EliminatedSystem eliminate_system(const Matrix &A, const Vector &b) {
     Matrix Ab = augment(A, b);
-    Matrix R = ref(Ab);
-    PivotInfo pivots = find_pivots_and_free_cols(R);
-    bool inconsistent = is_inconsistent(R, pivots);
-    EliminatedSystem system = {R, pivots, inconsistent};
+    EliminationInfo info = eliminate_system_inplace(Ab);
+    EliminatedSystem system = {std::move(Ab), std::move(info.pivots),
+                               info.inconsistent};
     return system;
 }
 } // namespace la
@@ -0,0 +1,660 @@
+#include "la/exact.hpp"
+#include "utils/joining_threads.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace la {
+namespace {
+// Largest integer below which every integer is a double: 2^53.
+constexpr double kMaxExactInteger = 9007199254740992.0;
+
+// Every prime used is above 2^30, so each adds at least 30 bits to the
+// modulus.
+constexpr double kBitsPerPrime = 30.0;
+
+// An integer matrix, row-major, copied out of the doubles once.
+struct IntMatrix {
+    std::size_t rows;
+    std::size_t cols;
+    std::vector<long long> a;
+};
+
+long long to_integer(double x) {
+    if (!(std::fabs(x) <= kMaxExactInteger) || std::floor(x) != x) {
+        throw std::invalid_argument(
+            "exact arithmetic needs integer entries of at most 2^53");
+    }
+    return static_cast<long long>(x);
+}
+
+// [A] or [A | b].
+IntMatrix to_integers(const Matrix &A, const Vector *b) {
+    const std::size_t w = A.cols() + (b ? 1 : 0);
+    IntMatrix M{A.rows(), w, std::vector<long long>(A.rows() * w)};
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            M.a[i * w + j] = to_integer(A(i, j));
+        }
+        if (b) {
+            M.a[i * w + A.cols()] = to_integer((*b)[i]);
+        }
+    }
+    return M;
+}
+
+// log2 of the Hadamard bound prod_i max(1, ||row i||), which bounds the
+// absolute value of every minor of M.
+double hadamard_log2(const IntMatrix &M) {
+    double bits = 0.0;
+    for (std::size_t i = 0; i < M.rows; ++i) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < M.cols; ++j) {
+            const double x = static_cast<double>(M.a[i * M.cols + j]);
+            sum += x * x;
+        }
+        if (sum > 1.0) {
+            bits += 0.5 * std::log2(sum);
+        }
+    }
+    return bits;
+}
+
+// Number of primes whose product surely exceeds 2^bits.
+std::size_t primes_for_bits(double bits) {
+    return static_cast<std::size_t>(std::ceil(bits / kBitsPerPrime)) + 1;
+}
+
+std::uint32_t mul_mod(std::uint32_t a, std::uint32_t b, std::uint32_t p) {
+    return static_cast<std::uint32_t>(std::uint64_t{a} * b % p);
+}
+
+std::uint32_t pow_mod(std::uint32_t a, std::uint32_t e, std::uint32_t p) {
+    std::uint32_t r = 1 % p;
+    while (e) {
+        if (e & 1u)
+            r = mul_mod(r, a, p);
+        a = mul_mod(a, a, p);
+        e >>= 1;
+    }
+    return r;
+}
+
+// a^{-1} mod p for prime p and a != 0 (Fermat).
+std::uint32_t inv_mod(std::uint32_t a, std::uint32_t p) {
+    return pow_mod(a, p - 2, p);
+}
+
+// Miller-Rabin with the bases 2, 7 and 61, exact for n < 2^32.
+bool is_prime(std::uint32_t n) {
+    if (n < 2)
+        return false;
+    for (std::uint32_t q : {2u, 3u, 5u, 7u, 61u}) {
+        if (n % q == 0)
+            return n == q;
+    }
+    std::uint32_t d = n - 1;
+    int s = 0;
+    while (!(d & 1u)) {
+        d >>= 1;
+        ++s;
+    }
+    for (std::uint32_t a : {2u, 7u, 61u}) {
+        std::uint32_t x = pow_mod(a, d, n);
+        if (x == 1 || x == n - 1)
+            continue;
+        bool composite = true;
+        for (int r = 1; r < s && composite; ++r) {
+            x = mul_mod(x, x, n);
+            composite = x != n - 1;
+        }
+        if (composite)
+            return false;
+    }
+    return true;
+}
+
+// Hands out distinct primes, largest first, starting below 2^31.
+class PrimeSource {
+  public:
+    std::vector<std::uint32_t> take(std::size_t count) {
+        std::vector<std::uint32_t> primes;
+        while (primes.size() < count) {
+            if (is_prime(next_)) {
+                primes.push_back(next_);
+            }
+            next_ -= 2;
+        }
+        return primes;
+    }
+
+  private:
+    std::uint32_t next_ = 2147483647u; // 2^31 - 1
+};
+
+// What one prime tells about [A | b] (or A alone).
+struct Channel {
+    std::uint32_t p = 0;
+    std::vector<std::size_t> pivot_cols; // pivots among the n_coef columns
+    bool inconsistent = false;           // a pivot in the RHS column
+    std::uint32_t det = 0;               // det(A) mod p, square A only
+    std::vector<std::uint32_t> x;        // solution, free variables zero
+};
+
+// Gaussian elimination of M modulo ch.p.  Columns from n_coef on are
+// right-hand sides.  The inner row update has no division: it reduces
+// with a quotient precomputed once per row, so it is a loop of 32-bit lane
+// operations that the compiler can vectorize (GCC does at -O3).
+void run_channel(const IntMatrix &M, std::size_t n_coef, bool want_solution,
+                 Channel &ch) {
+    const std::uint32_t p = ch.p;
+    const std::size_t m = M.rows;
+    const std::size_t w = M.cols;
+    const long long sp = static_cast<long long>(p);
+
+    std::vector<std::uint32_t> a(m * w);
+    for (std::size_t k = 0; k < a.size(); ++k) {
+        long long r = M.a[k] % sp;
+        a[k] = static_cast<std::uint32_t>(r < 0 ? r + sp : r);
+    }
+
+    std::uint32_t det = 1;
+    std::size_t r = 0;
+    for (std::size_t c = 0; c < w && r < m; ++c) {
+        std::size_t piv = r;
+        while (piv < m && a[piv * w + c] == 0) {
+            ++piv;
+        }
+        if (piv == m) {
+            continue;
+        }
+        if (piv != r) {
+            std::swap_ranges(a.begin() + piv * w, a.begin() + (piv + 1) * w,
+                             a.begin() + r * w);
+            det = det ? p - det : 0;
+        }
+
+        std::uint32_t *lead = a.data() + r * w;
+        det = mul_mod(det, lead[c], p);
+        const std::uint32_t inv = inv_mod(lead[c], p);
+        for (std::size_t j = c; j < w; ++j) {
+            lead[j] = mul_mod(lead[j], inv, p);
+        }
+        for (std::size_t i = r + 1; i < m; ++i) {
+            std::uint32_t *row = a.data() + i * w;
+            const std::uint32_t f = row[c];
+            if (f == 0)
+                continue;
+            // row += g lead with g = -f mod p.  g lead mod p uses Shoup's
+            // precomputed quotient g_pre = floor(g 2^32 / p), so each entry
+            // costs one widening multiply and 32-bit lane arithmetic, with
+            // no division.
+            const std::uint32_t g = p - f;
+            const std::uint32_t g_pre =
+                static_cast<std::uint32_t>((std::uint64_t{g} << 32) / p);
+            for (std::size_t j = c; j < w; ++j) {
+                const std::uint32_t q = static_cast<std::uint32_t>(
+                    (std::uint64_t{g_pre} * lead[j]) >> 32);
+                std::uint32_t t = g * lead[j] - q * p; // in [0, 2p)
+                t = t >= p ? t - p : t;
+                const std::uint32_t s = row[j] + t; // p < 2^31, no wrap
+                row[j] = s >= p ? s - p : s;
+            }
+        }
+
+        if (c < n_coef) {
+            ch.pivot_cols.push_back(c);
+        } else {
+            ch.inconsistent = true;
+        }
+        ++r;
+    }
+
+    const std::size_t rank = ch.pivot_cols.size();
+    ch.det = (m == n_coef && rank == m) ? det : 0;
+
+    if (want_solution && !ch.inconsistent) {
+        // Back substitution on the unit-diagonal echelon form.
+        ch.x.assign(n_coef, 0);
+        for (std::size_t k = rank; k-- > 0;) {
+            const std::uint32_t *row = a.data() + k * w;
+            std::uint64_t s = row[n_coef];
+            for (std::size_t l = k + 1; l < rank; ++l) {
+                const std::size_t col = ch.pivot_cols[l];
+                s += std::uint64_t{p - row[col]} * ch.x[col] % p;
+            }
+            ch.x[ch.pivot_cols[k]] = static_cast<std::uint32_t>(s % p);
+        }
+    }
+}
+
+// Run one channel per prime on up to n_threads threads.
+std::vector<Channel> run_channels(const IntMatrix &M, std::size_t n_coef,
+                                  bool want_solution,
+                                  const std::vector<std::uint32_t> &primes,
+                                  unsigned n_threads) {
+    std::vector<Channel> channels(primes.size());
+    for (std::size_t k = 0; k < primes.size(); ++k) {
+        channels[k].p = primes[k];
+    }
+    if (n_threads == 0) {
+        n_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const std::size_t workers =
+        std::min<std::size_t>(n_threads, channels.size());
+    if (workers <= 1) {
+        for (Channel &ch : channels) {
+            run_channel(M, n_coef, want_solution, ch);
+        }
+        return channels;
+    }
+
+    {
+        utils::JoiningThreads threads(workers);
+        for (std::size_t t = 0; t < workers; ++t) {
+            threads.spawn([&, t]() {
+                for (std::size_t k = t; k < channels.size(); k += workers) {
+                    run_channel(M, n_coef, want_solution, channels[k]);
+                }
+            });
+        }
+    }
+    return channels;
+}
+
+// Incremental Chinese remainder (Garner): x in [0, modulus) with
+// x = residues[k] mod primes[k].
+BigInt crt(const std::vector<std::uint32_t> &residues,
+           const std::vector<std::uint32_t> &primes, BigInt &modulus) {
+    BigInt x = 0;
+    modulus = 1;
+    for (std::size_t k = 0; k < primes.size(); ++k) {
+        const std::uint32_t p = primes[k];
+        const std::uint32_t xm = x.mod(p);
+        const std::uint32_t diff = residues[k] >= xm
+                                       ? residues[k] - xm
+                                       : p - (xm - residues[k]);
+        const std::uint32_t t = mul_mod(diff, inv_mod(modulus.mod(p), p), p);
+        x += modulus * BigInt(static_cast<long long>(t));
+        modulus *= BigInt(static_cast<long long>(p));
+    }
+    return x;
+}
+
+// x in (-modulus/2, modulus/2].
+BigInt symmetric(BigInt x, const BigInt &modulus) {
+    if (x * BigInt(2) > modulus) {
+        x -= modulus;
+    }
+    return x;
+}
+
+BigInt pow2(std::size_t k) {
+    BigInt r = 1;
+    for (; k >= 62; k -= 62) {
+        r *= BigInt(1LL << 62);
+    }
+    return r * BigInt(1LL << k);
+}
+
+// Find num/den = u mod modulus with |num| <= bound and 0 < den <= bound
+// by stopping the extended Euclidean algorithm half way (Wang).  Unique
+// when modulus > 2 bound^2.
+bool rational_reconstruct(const BigInt &u, const BigInt &modulus,
+                          const BigInt &bound, BigInt &num, BigInt &den) {
+    BigInt r0 = modulus, r1 = u;
+    BigInt t0 = 0, t1 = 1;
+    BigInt q, rem;
+    while (r1 > bound) {
+        BigInt::divmod(r0, r1, q, rem);
+        r0 = std::move(r1);
+        r1 = std::move(rem);
+        BigInt t2 = t0 - q * t1;
+        t0 = std::move(t1);
+        t1 = std::move(t2);
+    }
+    if (t1.is_zero() || abs(t1) > bound || gcd(r1, t1) != BigInt(1)) {
+        return false;
+    }
+    num = t1.sign() < 0 ? -r1 : r1;
+    den = abs(t1);
+    return true;
+}
+
+std::size_t max_rank(const std::vector<Channel> &channels) {
+    std::size_t r = 0;
+    for (const Channel &ch : channels) {
+        r = std::max(r, ch.pivot_cols.size());
+    }
+    return r;
+}
+
+void check_rhs(const Matrix &A, const Vector &b) {
+    if (b.size() != A.rows()) {
+        throw std::invalid_argument(
+            "Size of b must match number of rows in A");
+    }
+}
+
+// Rank of A and of [A | b], from primes whose product exceeds the
+// Hadamard bound of [A | b].
+SolutionKind kind_from(const std::vector<Channel> &channels,
+                       std::size_t n_coef) {
+    std::size_t rank_a = 0, rank_ab = 0;
+    for (const Channel &ch : channels) {
+        rank_a = std::max(rank_a, ch.pivot_cols.size());
+        rank_ab = std::max(rank_ab, ch.pivot_cols.size() +
+                                        (ch.inconsistent ? 1 : 0));
+    }
+    if (rank_ab > rank_a) {
+        return SolutionKind::None;
+    }
+    return rank_a == n_coef ? SolutionKind::Unique : SolutionKind::Infinite;
+}
+
+bool checked_mul(long long a, long long b, long long &out) {
+#if defined(__GNUC__) || defined(__clang__)
+    return !__builtin_mul_overflow(a, b, &out);
+#else
+    if (a != 0 && (b == LLONG_MIN || a == LLONG_MIN ||
+                   std::llabs(b) > LLONG_MAX / std::llabs(a))) {
+        return false;
+    }
+    out = a * b;
+    return true;
+#endif
+}
+
+bool checked_sub(long long a, long long b, long long &out) {
+#if defined(__GNUC__) || defined(__clang__)
+    return !__builtin_sub_overflow(a, b, &out);
+#else
+    if ((b > 0 && a < LLONG_MIN + b) || (b < 0 && a > LLONG_MAX + b)) {
+        return false;
+    }
+    out = a - b;
+    return true;
+#endif
+}
+
+// out = (akk aij - aik akj) / prev, false on 64-bit overflow.
+bool bareiss_step(long long akk, long long aij, long long aik, long long akj,
+                  long long prev, long long &out) {
+    long long x, y, d;
+    if (!checked_mul(akk, aij, x) || !checked_mul(aik, akj, y) ||
+        !checked_sub(x, y, d)) {
+        return false;
+    }
+    // The division is exact, but LLONG_MIN / -1 still overflows.
+    if (d == LLONG_MIN && prev == -1) {
+        return false;
+    }
+    out = d / prev;
+    return true;
+}
+
+bool bareiss_step(const BigInt &akk, const BigInt &aij, const BigInt &aik,
+                  const BigInt &akj, const BigInt &prev, BigInt &out) {
+    out = (akk * aij - aik * akj) / prev;
+    return true;
+}
+
+// Fraction-free elimination of the m x n row-major matrix a, for long long
+// or BigInt.  Returns false if a step overflows; a is then garbage.
+template <typename Int>
+bool bareiss_inplace(std::vector<Int> &a, std::size_t m, std::size_t n,
+                     PivotInfo &info, int &sign) {
+    info.pivot_cols.clear();
+    info.free_cols.clear();
+    sign = 1;
+    Int prev = 1;
+    std::size_t r = 0;
+    for (std::size_t c = 0; c < n; ++c) {
+        std::size_t piv = r;
+        while (piv < m && a[piv * n + c] == Int(0)) {
+            ++piv;
+        }
+        if (piv >= m) {
+            info.free_cols.push_back(c);
+            continue;
+        }
+        if (piv != r) {
+            std::swap_ranges(a.begin() + piv * n, a.begin() + (piv + 1) * n,
+                             a.begin() + r * n);
+            sign = -sign;
+        }
+
+        const Int &akk = a[r * n + c];
+        for (std::size_t i = r + 1; i < m; ++i) {
+            const Int aik = a[i * n + c];
+            for (std::size_t j = c + 1; j < n; ++j) {
+                if (!bareiss_step(akk, a[i * n + j], aik, a[r * n + j], prev,
+                                  a[i * n + j])) {
+                    return false;
+                }
+            }
+            a[i * n + c] = Int(0);
+        }
+        prev = akk;
+        info.pivot_cols.push_back(c);
+        ++r;
+    }
+    return true;
+}
+
+// Does x = nums / den satisfy A x = b exactly?
+bool satisfies(const IntMatrix &M, const std::vector<BigInt> &nums,
+               const BigInt &den) {
+    const std::size_t n = M.cols - 1;
+    for (std::size_t i = 0; i < M.rows; ++i) {
+        BigInt lhs = 0;
+        for (std::size_t j = 0; j < n; ++j) {
+            const long long a = M.a[i * M.cols + j];
+            if (a != 0 && !nums[j].is_zero()) {
+                lhs += BigInt(a) * nums[j];
+            }
+        }
+        if (lhs != BigInt(M.a[i * M.cols + n]) * den) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+Vector ExactSolution::to_vector() const {
+    Vector x(numerators.size());
+    const double d = denominator.to_double();
+    for (std::size_t i = 0; i < numerators.size(); ++i) {
+        x[i] = numerators[i].to_double() / d;
+    }
+    return x;
+}
+
+std::size_t exact_rank(const Matrix &A, unsigned n_threads) {
+    const IntMatrix M = to_integers(A, nullptr);
+    const std::size_t full = std::min(A.rows(), A.cols());
+    if (full == 0) {
+        return 0;
+    }
+
+    // Rank modulo p never exceeds the true rank, and equals it for all
+    // primes but those dividing a maximal nonzero minor.  A full-rank
+    // answer from one prime is therefore final.
+    PrimeSource source;
+    std::vector<Channel> first =
+        run_channels(M, A.cols(), false, source.take(1), 1);
+    if (first[0].pivot_cols.size() == full) {
+        return full;
+    }
+    const std::size_t count = primes_for_bits(hadamard_log2(M));
+    std::vector<Channel> rest =
+        run_channels(M, A.cols(), false, source.take(count), n_threads);
+    return std::max(first[0].pivot_cols.size(), max_rank(rest));
+}
+
+BigInt exact_determinant(const Matrix &A, unsigned n_threads) {
+    if (A.rows() != A.cols()) {
+        throw std::invalid_argument(
+            "exact_determinant: matrix must be square");
+    }
+    const IntMatrix M = to_integers(A, nullptr);
+
+    // |det A| <= H, so residues modulo a product above 2H fix it.
+    const std::size_t count = primes_for_bits(hadamard_log2(M) + 1.0);
+    PrimeSource source;
+    const std::vector<std::uint32_t> primes = source.take(count);
+    const std::vector<Channel> channels =
+        run_channels(M, A.cols(), false, primes, n_threads);
+
+    std::vector<std::uint32_t> residues;
+    residues.reserve(channels.size());
+    for (const Channel &ch : channels) {
+        residues.push_back(ch.det);
+    }
+    BigInt modulus;
+    const BigInt x = crt(residues, primes, modulus);
+    return symmetric(x, modulus);
+}
+
+SolutionKind exact_n_solutions(const Matrix &A, const Vector &b,
+                               unsigned n_threads) {
+    check_rhs(A, b);
+    const IntMatrix M = to_integers(A, &b);
+    PrimeSource source;
+    const std::size_t count = primes_for_bits(hadamard_log2(M));
+    return kind_from(
+        run_channels(M, A.cols(), false, source.take(count), n_threads),
+        A.cols());
+}
+
+bool exact_is_in_span(const Matrix &A, const Vector &b, unsigned n_threads) {
+    return exact_n_solutions(A, b, n_threads) != SolutionKind::None;
+}
+
+ExactSolution exact_solve(const Matrix &A, const Vector &b,
+                          unsigned n_threads) {
+    check_rhs(A, b);
+    const IntMatrix M = to_integers(A, &b);
+    const std::size_t n = A.cols();
+
+    ExactSolution sol;
+    PrimeSource source;
+    const double h_bits = hadamard_log2(M);
+    std::vector<Channel> channels = run_channels(
+        M, n, true, source.take(primes_for_bits(h_bits)), n_threads);
+    sol.kind = kind_from(channels, n);
+    if (sol.kind == SolutionKind::None) {
+        return sol;
+    }
+
+    // By Cramer's rule numerator and denominator are minors of [A | b],
+    // so both are at most H; reconstruction needs a modulus above 2 H^2.
+    const std::size_t k = static_cast<std::size_t>(std::ceil(h_bits)) + 1;
+    const BigInt bound = pow2(k);
+    const double needed_bits = 2.0 * static_cast<double>(k) + 1.0;
+
+    const std::size_t rank = max_rank(channels);
+    for (;;) {
+        // Good primes see the rank and the leftmost pivot columns of the
+        // rationals; the others are skipped.
+        const std::vector<std::size_t> *best = nullptr;
+        for (const Channel &ch : channels) {
+            if (ch.pivot_cols.size() == rank && !ch.inconsistent &&
+                (!best || ch.pivot_cols < *best)) {
+                best = &ch.pivot_cols;
+            }
+        }
+        std::vector<const Channel *> good;
+        for (const Channel &ch : channels) {
+            if (best && ch.pivot_cols == *best && !ch.inconsistent) {
+                good.push_back(&ch);
+            }
+        }
+
+        std::size_t missing =
+            primes_for_bits(needed_bits) > good.size()
+                ? primes_for_bits(needed_bits) - good.size()
+                : 0;
+        if (missing == 0) {
+            std::vector<std::uint32_t> primes, residues;
+            for (const Channel *ch : good) {
+                primes.push_back(ch->p);
+            }
+
+            std::vector<BigInt> nums(n), dens(n);
+            BigInt lcm = 1;
+            bool ok = true;
+            for (std::size_t j = 0; j < n && ok; ++j) {
+                residues.clear();
+                for (const Channel *ch : good) {
+                    residues.push_back(ch->x[j]);
+                }
+                BigInt modulus;
+                const BigInt u = crt(residues, primes, modulus);
+                ok = rational_reconstruct(u, modulus, bound, nums[j],
+                                          dens[j]);
+                if (ok) {
+                    lcm = lcm / gcd(lcm, dens[j]) * dens[j];
+                }
+            }
+            if (ok) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    nums[j] *= lcm / dens[j];
+                }
+                if (satisfies(M, nums, lcm)) {
+                    sol.numerators = std::move(nums);
+                    sol.denominator = std::move(lcm);
+                    return sol;
+                }
+            }
+            // Only reachable if the structure was misjudged: widen.
+            missing = good.size();
+        }
+
+        std::vector<Channel> more =
+            run_channels(M, n, true, source.take(missing), n_threads);
+        for (Channel &ch : more) {
+            channels.push_back(std::move(ch));
+        }
+    }
+}
+
+FractionFreeEchelon fraction_free_ref(const Matrix &A) {
+    const IntMatrix M = to_integers(A, nullptr);
+    FractionFreeEchelon E;
+    E.rows = M.rows;
+    E.cols = M.cols;
+
+    // 64-bit first; start over with BigInt only if that overflows.
+    std::vector<long long> a = M.a;
+    if (bareiss_inplace(a, M.rows, M.cols, E.pivots, E.sign)) {
+        E.entries.assign(a.begin(), a.end());
+        return E;
+    }
+    E.entries.assign(M.a.begin(), M.a.end());
+    bareiss_inplace(E.entries, M.rows, M.cols, E.pivots, E.sign);
+    return E;
+}
+
+BigInt bareiss_determinant(const Matrix &A) {
+    if (A.rows() != A.cols()) {
+        throw std::invalid_argument(
+            "bareiss_determinant: matrix must be square");
+    }
+    const std::size_t n = A.rows();
+    if (n == 0) {
+        return 1;
+    }
+    const FractionFreeEchelon E = fraction_free_ref(A);
+    if (E.rank() < n) {
+        return 0;
+    }
+    return E.sign < 0 ? -E(n - 1, n - 1) : E(n - 1, n - 1);
+}
+} // namespace la
@@ -0,0 +1,153 @@
+#include "la/gram_schmidt.hpp"
+#include "math_utils/math_utils.hpp"
+#include "utils/joining_threads.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace la {
+namespace {
+// Columns per block, and the work (rows x columns) below which the block
+// products stay on the calling thread.
+constexpr std::size_t kBlock = 32;
+constexpr std::size_t kParallelMin = 1 << 16;
+
+// Run f(stripe, first_row, last_row) over `workers` stripes of m rows.
+template <typename F>
+void for_row_stripes(std::size_t m, std::size_t workers, F f) {
+    if (workers <= 1) {
+        f(0, 0, m);
+        return;
+    }
+    utils::JoiningThreads threads(workers);
+    for (std::size_t s = 0; s < workers; ++s) {
+        threads.spawn(f, s, m * s / workers, m * (s + 1) / workers);
+    }
+}
+
+// A(:, c0:c1) -= Q Q^T A(:, c0:c1) with Q = A(:, 0:r), the coefficients
+// Q^T A(:, c0:c1) summed over row stripes.  C (workers x r x bs) is
+// scratch.
+void project_block(Matrix &A, std::size_t r, std::size_t c0, std::size_t c1,
+                   std::size_t workers, std::vector<double> &C) {
+    const std::size_t bs = c1 - c0;
+    const std::size_t rb = r * bs;
+    C.assign(workers * rb, 0.0);
+
+    for_row_stripes(A.rows(), workers,
+                    [&](std::size_t s, std::size_t i0, std::size_t i1) {
+                        double *c = C.data() + s * rb;
+                        for (std::size_t i = i0; i < i1; ++i) {
+                            for (std::size_t q = 0; q < r; ++q) {
+                                const double aq = A(i, q);
+                                double *cq = c + q * bs;
+                                for (std::size_t j = 0; j < bs; ++j) {
+                                    cq[j] += aq * A(i, c0 + j);
+                                }
+                            }
+                        }
+                    });
+    for (std::size_t s = 1; s < workers; ++s) {
+        const double *cs = C.data() + s * rb;
+        for (std::size_t k = 0; k < rb; ++k) {
+            C[k] += cs[k];
+        }
+    }
+
+    for_row_stripes(A.rows(), workers,
+                    [&](std::size_t, std::size_t i0, std::size_t i1) {
+                        for (std::size_t i = i0; i < i1; ++i) {
+                            for (std::size_t q = 0; q < r; ++q) {
+                                const double aq = A(i, q);
+                                const double *cq = C.data() + q * bs;
+                                for (std::size_t j = 0; j < bs; ++j) {
+                                    A(i, c0 + j) -= aq * cq[j];
+                                }
+                            }
+                        }
+                    });
+}
+
+// Column j of A minus its projections on columns [r0, r), twice.
+void project_column(Matrix &A, std::size_t r0, std::size_t r, std::size_t j,
+                    std::vector<double> &c) {
+    c.resize(r - r0);
+    for (int pass = 0; pass < 2; ++pass) {
+        std::fill(c.begin(), c.end(), 0.0);
+        for (std::size_t i = 0; i < A.rows(); ++i) {
+            const double aj = A(i, j);
+            for (std::size_t k = r0; k < r; ++k) {
+                c[k - r0] += A(i, k) * aj;
+            }
+        }
+        for (std::size_t i = 0; i < A.rows(); ++i) {
+            double sum = 0.0;
+            for (std::size_t k = r0; k < r; ++k) {
+                sum += c[k - r0] * A(i, k);
+            }
+            A(i, j) -= sum;
+        }
+    }
+}
+
+double column_norm(const Matrix &A, std::size_t j) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        sum += A(i, j) * A(i, j);
+    }
+    return std::sqrt(sum);
+}
+} // namespace
+
+PivotInfo orthonormalize_columns(Matrix &A, unsigned n_threads) {
+    const std::size_t m = A.rows();
+    const std::size_t n = A.cols();
+    if (n_threads == 0) {
+        n_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const std::size_t workers =
+        m * n < kParallelMin ? 1 : std::min<std::size_t>(n_threads, m);
+
+    PivotInfo info;
+    std::vector<double> C;
+    std::vector<double> scale(kBlock);
+    std::vector<double> c;
+    std::size_t r = 0; // basis columns so far, packed into [0, r)
+    for (std::size_t c0 = 0; c0 < n; c0 += kBlock) {
+        const std::size_t c1 = std::min(n, c0 + kBlock);
+        for (std::size_t j = c0; j < c1; ++j) {
+            scale[j - c0] = column_norm(A, j);
+        }
+
+        // Against the earlier blocks: two block-wide passes.
+        if (r > 0) {
+            project_block(A, r, c0, c1, workers, C);
+            project_block(A, r, c0, c1, workers, C);
+        }
+
+        // Within the block, one column at a time.
+        const std::size_t r0 = r;
+        for (std::size_t j = c0; j < c1; ++j) {
+            project_column(A, r0, r, j, c);
+            const double norm = column_norm(A, j);
+            if (math_utils::is_effectively_zero(norm, scale[j - c0])) {
+                info.free_cols.push_back(j);
+                continue;
+            }
+            for (std::size_t i = 0; i < m; ++i) {
+                A(i, r) = A(i, j) / norm;
+            }
+            info.pivot_cols.push_back(j);
+            ++r;
+        }
+    }
+
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = r; j < n; ++j) {
+            A(i, j) = 0.0;
+        }
+    }
+    return info;
+}
+} // namespace la
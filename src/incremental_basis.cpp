@@ -0,0 +1,109 @@
+#include "la/incremental_basis.hpp"
+#include "math_utils/math_utils.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace la {
+namespace {
+double norm2(const double *x, std::size_t n) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += x[i] * x[i];
+    }
+    return std::sqrt(sum);
+}
+} // namespace
+
+IncrementalBasis::IncrementalBasis(std::size_t dim)
+    : dim_(dim), residual_(dim) {}
+
+void IncrementalBasis::check_size(const Vector &v) const {
+    if (v.size() != dim_) {
+        throw std::invalid_argument(
+            "IncrementalBasis: vector size must match the basis dimension");
+    }
+}
+
+bool IncrementalBasis::project_out(const Vector &v) const {
+    double *r = residual_.data();
+    for (std::size_t j = 0; j < dim_; ++j) {
+        r[j] = v[j];
+    }
+    const double scale = norm2(r, dim_);
+
+    // Two classical Gram-Schmidt passes: the second removes what rounding
+    // left of the basis directions after the first.
+    coeffs_.resize(rank_);
+    for (int pass = 0; pass < 2; ++pass) {
+        for (std::size_t i = 0; i < rank_; ++i) {
+            const double *q = q_.data() + i * dim_;
+            double c = 0.0;
+            for (std::size_t j = 0; j < dim_; ++j) {
+                c += q[j] * r[j];
+            }
+            coeffs_[i] = c;
+        }
+        for (std::size_t i = 0; i < rank_; ++i) {
+            const double *q = q_.data() + i * dim_;
+            const double c = coeffs_[i];
+            for (std::size_t j = 0; j < dim_; ++j) {
+                r[j] -= c * q[j];
+            }
+        }
+    }
+
+    return math_utils::is_effectively_zero(norm2(r, dim_), scale);
+}
+
+bool IncrementalBasis::add(const Vector &v) {
+    check_size(v);
+    if (is_full() || project_out(v)) {
+        return false;
+    }
+
+    const double norm = norm2(residual_.data(), dim_);
+    q_.resize((rank_ + 1) * dim_);
+    double *q = q_.data() + rank_ * dim_;
+    for (std::size_t j = 0; j < dim_; ++j) {
+        q[j] = residual_[j] / norm;
+    }
+    ++rank_;
+    return true;
+}
+
+bool IncrementalBasis::contains(const Vector &v) const {
+    check_size(v);
+    return is_full() || project_out(v);
+}
+
+Matrix IncrementalBasis::basis() const {
+    Matrix Q(rank_, dim_);
+    for (std::size_t i = 0; i < rank_; ++i) {
+        for (std::size_t j = 0; j < dim_; ++j) {
+            Q(i, j) = q_[i * dim_ + j];
+        }
+    }
+    return Q;
+}
+
+bool are_linearly_independent_incremental(const std::vector<Vector> &vectors) {
+    if (vectors.empty())
+        return true;
+
+    const std::size_t dim = vectors[0].size();
+    for (const Vector &v : vectors) {
+        if (v.size() != dim)
+            throw std::invalid_argument("vector sizes must match");
+    }
+    // More vectors than dimensions are always dependent.
+    if (vectors.size() > dim)
+        return false;
+
+    IncrementalBasis basis(dim);
+    for (const Vector &v : vectors) {
+        if (!basis.add(v))
+            return false; // stop at the first dependent vector
+    }
+    return true;
+}
+} // namespace la
@@ -0,0 +1,69 @@
+#include "la/instrument.hpp"
+#include <atomic>
+
+namespace la {
+namespace instrument {
+namespace {
+#ifdef LA_INSTRUMENT
+// Relaxed atomics: the counts only need to be exact once the threads that
+// produced them have been joined.
+std::atomic<std::size_t> g_allocations{0};
+std::atomic<std::size_t> g_bytes{0};
+std::atomic<std::size_t> g_matrix_copies{0};
+std::atomic<std::size_t> g_vector_copies{0};
+#endif
+} // namespace
+
+Counters operator-(const Counters &after, const Counters &before) noexcept {
+    Counters d;
+    d.allocations = after.allocations - before.allocations;
+    d.bytes = after.bytes - before.bytes;
+    d.matrix_copies = after.matrix_copies - before.matrix_copies;
+    d.vector_copies = after.vector_copies - before.vector_copies;
+    return d;
+}
+
+Counters snapshot() noexcept {
+    Counters c;
+#ifdef LA_INSTRUMENT
+    c.allocations = g_allocations.load(std::memory_order_relaxed);
+    c.bytes = g_bytes.load(std::memory_order_relaxed);
+    c.matrix_copies = g_matrix_copies.load(std::memory_order_relaxed);
+    c.vector_copies = g_vector_copies.load(std::memory_order_relaxed);
+#endif
+    return c;
+}
+
+void reset() noexcept {
+#ifdef LA_INSTRUMENT
+    g_allocations.store(0, std::memory_order_relaxed);
+    g_bytes.store(0, std::memory_order_relaxed);
+    g_matrix_copies.store(0, std::memory_order_relaxed);
+    g_vector_copies.store(0, std::memory_order_relaxed);
+#endif
+}
+
+namespace detail {
+void record_allocation(std::size_t bytes) noexcept {
+#ifdef LA_INSTRUMENT
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(bytes, std::memory_order_relaxed);
+#else
+    (void)bytes;
+#endif
+}
+
+void record_copy(Kind kind) noexcept {
+#ifdef LA_INSTRUMENT
+    if (kind == Kind::Matrix) {
+        g_matrix_copies.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        g_vector_copies.fetch_add(1, std::memory_order_relaxed);
+    }
+#else
+    (void)kind;
+#endif
+}
+} // namespace detail
+} // namespace instrument
+} // namespace la
@@ -0,0 +1,260 @@
+#include "la/linear_code.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace la {
+namespace {
+// error_at_ entry for a syndrome that more than one position produces.
+constexpr std::uint32_t kAmbiguous = 0xffffffffu;
+
+std::uint8_t byte_at(const std::uint64_t *w, std::size_t b) noexcept {
+    return static_cast<std::uint8_t>(w[b / 8] >> (8 * (b % 8)));
+}
+
+int lowest_bit(unsigned v) noexcept {
+    int i = 0;
+    while (!((v >> i) & 1u)) {
+        ++i;
+    }
+    return i;
+}
+
+// table[b * 256 + v] = XOR of values[8 b + i] over the set bits i of v.
+std::vector<std::uint32_t>
+byte_tables(const std::vector<std::uint32_t> &values) {
+    const std::size_t bytes = (values.size() + 7) / 8;
+    std::vector<std::uint32_t> table(bytes * 256);
+    for (std::size_t b = 0; b < bytes; ++b) {
+        std::uint32_t *t = table.data() + b * 256;
+        for (unsigned v = 1; v < 256; ++v) {
+            const std::size_t j = 8 * b + static_cast<std::size_t>(
+                                              lowest_bit(v));
+            t[v] = t[v & (v - 1)] ^ (j < values.size() ? values[j] : 0);
+        }
+    }
+    return table;
+}
+
+void check_length(std::size_t got, std::size_t want, const char *what) {
+    if (got != want) {
+        throw std::invalid_argument(what);
+    }
+}
+} // namespace
+
+constexpr std::size_t LinearCode::kMaxRedundancy;
+
+LinearCode::LinearCode(const BitMatrix &G) : g_(G) {
+    const std::size_t k = G.rows();
+    const std::size_t n = G.cols();
+    info_ = rref_inplace(g_);
+    if (k == 0 || info_.pivot_cols.size() != k) {
+        throw std::invalid_argument(
+            "LinearCode: generator rows must be linearly independent");
+    }
+    const std::size_t r = n - k;
+    if (r > kMaxRedundancy) {
+        throw std::invalid_argument("LinearCode: too many parity checks");
+    }
+    systematic_ = info_.pivot_cols.back() == k - 1;
+
+    // Parity bit t sits at free column f_t and sums the message bits i
+    // with G(i, f_t) = 1: parity[i] holds those bits of row i.
+    std::vector<std::uint32_t> parity(k);
+    for (std::size_t i = 0; i < k; ++i) {
+        for (std::size_t t = 0; t < r; ++t) {
+            if (g_(i, info_.free_cols[t])) {
+                parity[i] |= std::uint32_t{1} << t;
+            }
+        }
+    }
+
+    // H = [P^T at the pivot columns | I at the free columns]; column j of
+    // H is the syndrome of a single error at j.
+    std::vector<std::uint32_t> column(n);
+    for (std::size_t i = 0; i < k; ++i) {
+        column[info_.pivot_cols[i]] = parity[i];
+    }
+    for (std::size_t t = 0; t < r; ++t) {
+        column[info_.free_cols[t]] = std::uint32_t{1} << t;
+    }
+    h_ = BitMatrix(r, n);
+    for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t t = 0; t < r; ++t) {
+            if ((column[j] >> t) & 1u) {
+                h_.set(t, j);
+            }
+        }
+    }
+
+    parity_table_ = byte_tables(parity);
+    syndrome_table_ = byte_tables(column);
+
+    error_at_.assign(std::size_t{1} << r, 0);
+    for (std::size_t j = 0; j < n; ++j) {
+        std::uint32_t &e = error_at_[column[j]];
+        if (column[j] != 0) {
+            e = e == 0 ? static_cast<std::uint32_t>(j + 1) : kAmbiguous;
+        }
+    }
+}
+
+LinearCode LinearCode::hamming(unsigned r) {
+    if (r < 2 || r > 12) {
+        throw std::invalid_argument(
+            "LinearCode::hamming: r must be in [2, 12]");
+    }
+    // H = [A | I] where the columns of A are all r-bit values of weight at
+    // least two; then G = [I | A^T].
+    const std::size_t n = (std::size_t{1} << r) - 1;
+    const std::size_t k = n - r;
+    BitMatrix G(k, n);
+    std::size_t i = 0;
+    for (std::uint32_t v = 1; v <= n; ++v) {
+        if ((v & (v - 1)) == 0)
+            continue; // weight one: a parity position
+        G.set(i, i);
+        for (unsigned t = 0; t < r; ++t) {
+            if ((v >> t) & 1u) {
+                G.set(i, k + t);
+            }
+        }
+        ++i;
+    }
+    return LinearCode(G);
+}
+
+std::uint32_t LinearCode::syndrome_of(const std::uint64_t *w) const noexcept {
+    const std::size_t bytes = (length() + 7) / 8;
+    std::uint32_t s = 0;
+    for (std::size_t b = 0; b < bytes; ++b) {
+        s ^= syndrome_table_[b * 256 + byte_at(w, b)];
+    }
+    return s;
+}
+
+void LinearCode::encode_into(const std::uint64_t *m,
+                             std::uint64_t *c) const noexcept {
+    const std::size_t k = dimension();
+    const std::size_t r = redundancy();
+    const std::size_t bytes = (k + 7) / 8;
+    std::uint32_t parity = 0;
+    for (std::size_t b = 0; b < bytes; ++b) {
+        parity ^= parity_table_[b * 256 + byte_at(m, b)];
+    }
+
+    const std::size_t stride = (length() + 63) / 64;
+    std::fill(c, c + stride, 0);
+    if (systematic_) {
+        // [m | parity]: copy the message words, then shift the parity bits
+        // in after bit k.
+        std::copy(m, m + (k + 63) / 64, c);
+        if (r == 0) {
+            return; // no parity bits; c[k / 64] may be past the end
+        }
+        const std::size_t off = k % 64;
+        c[k / 64] |= std::uint64_t{parity} << off;
+        if (off + r > 64) {
+            c[k / 64 + 1] |= std::uint64_t{parity} >> (64 - off);
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < k; ++i) {
+        if ((m[i / 64] >> (i % 64)) & 1u) {
+            const std::size_t j = info_.pivot_cols[i];
+            c[j / 64] |= std::uint64_t{1} << (j % 64);
+        }
+    }
+    for (std::size_t t = 0; t < r; ++t) {
+        if ((parity >> t) & 1u) {
+            const std::size_t j = info_.free_cols[t];
+            c[j / 64] |= std::uint64_t{1} << (j % 64);
+        }
+    }
+}
+
+DecodeStatus LinearCode::correct_words(std::uint64_t *w) const noexcept {
+    const std::uint32_t s = syndrome_of(w);
+    if (s == 0) {
+        return DecodeStatus::Clean;
+    }
+    const std::uint32_t e = error_at_[s];
+    if (e == 0 || e == kAmbiguous) {
+        return DecodeStatus::Uncorrectable;
+    }
+    const std::size_t j = e - 1;
+    w[j / 64] ^= std::uint64_t{1} << (j % 64);
+    return DecodeStatus::Corrected;
+}
+
+BitVector LinearCode::encode(const BitVector &m) const {
+    check_length(m.size(), dimension(),
+                 "LinearCode::encode: message size must match k");
+    BitVector c(length());
+    encode_into(m.data(), c.data());
+    return c;
+}
+
+BitMatrix LinearCode::encode(const BitMatrix &messages) const {
+    check_length(messages.cols(), dimension(),
+                 "LinearCode::encode: message size must match k");
+    BitMatrix C(messages.rows(), length());
+    for (std::size_t i = 0; i < messages.rows(); ++i) {
+        encode_into(messages.row_data(i), C.row_data(i));
+    }
+    return C;
+}
+
+BitVector LinearCode::message(const BitVector &c) const {
+    check_length(c.size(), length(),
+                 "LinearCode::message: codeword size must match n");
+    BitVector m(dimension());
+    for (std::size_t i = 0; i < dimension(); ++i) {
+        m.set(i, c[info_.pivot_cols[i]]);
+    }
+    return m;
+}
+
+std::uint32_t LinearCode::syndrome(const BitVector &w) const {
+    check_length(w.size(), length(),
+                 "LinearCode::syndrome: word size must match n");
+    return syndrome_of(w.data());
+}
+
+std::vector<std::uint32_t>
+LinearCode::syndromes(const BitMatrix &words) const {
+    check_length(words.cols(), length(),
+                 "LinearCode::syndromes: word size must match n");
+    std::vector<std::uint32_t> s(words.rows());
+    for (std::size_t i = 0; i < words.rows(); ++i) {
+        s[i] = syndrome_of(words.row_data(i));
+    }
+    return s;
+}
+
+DecodeStatus LinearCode::correct(BitVector &w) const {
+    check_length(w.size(), length(),
+                 "LinearCode::correct: word size must match n");
+    return correct_words(w.data());
+}
+
+DecodeSummary LinearCode::correct(BitMatrix &words) const {
+    check_length(words.cols(), length(),
+                 "LinearCode::correct: word size must match n");
+    DecodeSummary summary;
+    for (std::size_t i = 0; i < words.rows(); ++i) {
+        switch (correct_words(words.row_data(i))) {
+        case DecodeStatus::Clean:
+            ++summary.clean;
+            break;
+        case DecodeStatus::Corrected:
+            ++summary.corrected;
+            break;
+        case DecodeStatus::Uncorrectable:
+            summary.uncorrectable.push_back(i);
+            break;
+        }
+    }
+    return summary;
+}
+} // namespace la
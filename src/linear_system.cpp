@@ -3,10 +3,12 @@
 #include "la/matrix.hpp"
 #include "la/matrix_algorithms.hpp"
 #include "la/pivot_info.hpp"
+#include "la/triangular_matrix.hpp"
 #include <stdexcept>
+#include <utility>
 
 namespace la {
-Vector back_substitute_unique(const Matrix &A, const Vector &b);
+Vector back_substitute_unique(const TriangularMatrix &U, const Vector &b);
 LinearSystemSolution extract_parametric(const Matrix &R);
 Vector extract_unique(const Matrix &R);
 
@@ -25,7 +27,6 @@ LinearSystemSolution extract_parametric(const Matrix &R) {
     LinearSystemSolution sol;
     sol.kind = SolutionKind::Infinite;
     sol.particular = Vector(n); // zero vector
-    sol.directions.clear();
 
     PivotInfo piv = find_pivots_and_free_cols(R);
 
@@ -41,15 +42,14 @@ LinearSystemSolution extract_parametric(const Matrix &R) {
     }
     sol.particular = x;
 
-    // --- 2. Directions: null space basis, one per free variable ---
-    sol.directions.reserve(piv.free_cols.size());
+    // --- 2. Directions: null space basis, one column per free variable ---
+    sol.null_space = Matrix(n, piv.free_cols.size());
 
     for (std::size_t k = 0; k < piv.free_cols.size(); ++k) {
         std::size_t free_col = piv.free_cols[k];
 
-        Vector dir(n);       // start with all zeros
         // use at() instead of [] because we get c from a different context
-        dir.at(free_col) = 1.0; // this parameter is "1", others "0"
+        sol.null_space.at(free_col, k) = 1.0; // this parameter is "1"
 
         // For each pivot row, express pivot variable in terms of this free
         // variable
@@ -62,10 +62,8 @@ LinearSystemSolution extract_parametric(const Matrix &R) {
             // x_pivot + sum_j R(i, j) * x_j = RHS
             // For homogeneous system A*n = 0: x_pivot = - sum_j R(i, j) * x_j
             // use at() instead of [] because we get c from a different context
-            dir.at(pivot_col) = -coeff;
+            sol.null_space.at(pivot_col, k) = -coeff;
         }
-
-        sol.directions.push_back(std::move(dir));
     }
 
     return sol;
@@ -81,69 +79,39 @@ Vector extract_unique(const Matrix &R) {
     return R.column(n).head(n);
 }
 
-SolutionKind n_solutions(const Matrix &A, const Vector &b) {
-    EliminatedSystem es = eliminate_system(A, b);
-
-    if (es.inconsistent == true) {
-        return SolutionKind::None;
-    }
-
-    std::size_t n = A.cols();
-
-    Matrix ref_A = es.R.col_range(0, A.cols());
-
-    std::size_t rankA = rank_from_ref(ref_A);
-    const std::size_t n_free_variables = (n > rankA) ? (n - rankA) : 0;
-
-    if (n_free_variables == 0) {
-        // We have already established that system is consistent to zero
-        // free variables means unique solution
-        return SolutionKind::Unique;
-    } else if (n_free_variables > 0) {
-        // consistent and infinite solutions
-        return SolutionKind::Infinite;
-    }
-
-    // Should never reach this point, just keeping compiler happy
-    return SolutionKind::None;
-}
-
 // This is for Gaussian elimination with unique solution from REF.
-Vector back_substitute_unique(const Matrix &U, const Vector &b) {
-    std::size_t n = U.cols();
-    Vector x(n);
-
-    for (std::size_t i = n; i-- > 0;) {
-        double sum = 0.0;
-        for (std::size_t j = i + 1; j < n; ++j) {
-            sum += U(i, j) * x[j];
-        }
-        // reasoning for b[i] being correct is far away, use at()
-        x[i] = (b.at(i) - sum) / U(i, i);
-    }
-
-    return x;
+Vector back_substitute_unique(const TriangularMatrix &U, const Vector &b) {
+    // reasoning for b having at least n entries is far away, check it
+    if (b.size() == U.rows())
+        return trsv(U, b);
+    return trsv(U, b.subvector(0, U.rows()));
 }
 
-LinearSystemSolution back_substitute_parametric(const Matrix &R,
-                                                const PivotInfo &pivots) {
+namespace {
+// Back-substitute the echelon form R with right-hand side column col of B
+// into caller-owned buffers, reusing their capacity.  particular gets the
+// solution with all free variables zero, N the null-space basis with one
+// column per free variable.
+void back_substitute_into(const Matrix &R, const Matrix &B, std::size_t col,
+                          const PivotInfo &pivots, Vector &particular,
+                          Matrix &N) {
     // Written by ChatGPT 5.2
-    const std::size_t n = R.cols() - 1;             // #variables
+    const std::size_t n = R.cols();                 // #variables
     const std::size_t r = pivots.pivot_cols.size(); // #pivot rows
     const std::size_t k = pivots.free_cols.size();  // #free vars
 
-    Vector particular(n);                         // assumes zero-init
-    std::vector<Vector> directions(k, Vector(n)); // assumes zero-init
+    particular.assign(n);
+    N.assign(n, k);
 
     // 1) Initialize free variables:
     //    particular: all free vars = 0
-    //    directions: direction j has free var f_j = 1
+    //    null space: column j has free var f_j = 1
     for (std::size_t j = 0; j < k; ++j) {
         const std::size_t f = pivots.free_cols[j];
         if (f >= n)
             throw std::out_of_range(
                 "back_substitute_parametric: free column index out of range");
-        directions[j][f] = 1.0;
+        N(f, j) = 1.0;
     }
 
     // 2) Back-substitute pivot variables bottom-up.
@@ -164,47 +132,153 @@ LinearSystemSolution back_substitute_parametric(const Matrix &R,
         for (std::size_t j = p + 1; j < n; ++j) {
             sum_part += R(ii, j) * particular[j];
         }
-        const double rhs = R(ii, n); // augmented column
+        const double rhs = B(ii, col);
         particular[p] = (rhs - sum_part) / piv;
 
-        // Directions: x_p = -(sum_j>p a_ij x_j) / piv   (homogeneous)
-        for (std::size_t d = 0; d < k; ++d) {
-            double sum_dir = 0.0;
-            for (std::size_t j = p + 1; j < n; ++j) {
-                sum_dir += R(ii, j) * directions[d][j];
+        // Null space: N(p, :) = -(sum_j>p a_ij N(j, :)) / piv, solved for
+        // all k columns at once so the inner loop runs along rows of N.
+        if (k == 0)
+            continue;
+        for (std::size_t j = p + 1; j < n; ++j) {
+            const double a = R(ii, j);
+            if (a == 0.0)
+                continue;
+            for (std::size_t d = 0; d < k; ++d) {
+                N(p, d) -= a * N(j, d);
             }
-            directions[d][p] = -sum_dir / piv;
+        }
+        for (std::size_t d = 0; d < k; ++d) {
+            N(p, d) /= piv;
         }
     }
+}
 
-    return {SolutionKind::Infinite, particular, directions};
+void check_rhs_rows(const Matrix &A, std::size_t rows) {
+    if (rows != A.rows()) {
+        throw std::invalid_argument(
+            "Size of b must match number of rows in A");
+    }
 }
 
-LinearSystemSolution solve(const Matrix &A, const Vector &b) {
-    LinearSystemSolution sol;
-    EliminatedSystem es = eliminate_system(A, b);
+} // namespace
 
-    if (es.inconsistent) {
+void solution_from_ref(const Matrix &R, const Matrix &B, std::size_t col,
+                       const PivotInfo &pivots, LinearSystemSolution &sol) {
+    if (is_inconsistent(B, col, pivots)) {
         sol.kind = SolutionKind::None;
+        sol.particular.assign(0);
+        sol.null_space.assign(0, 0);
+        return;
     }
+    sol.kind = pivots.free_cols.empty() ? SolutionKind::Unique
+                                        : SolutionKind::Infinite;
+    back_substitute_into(R, B, col, pivots, sol.particular, sol.null_space);
+}
 
-    else if (es.pivots.free_cols.empty()) {
-        sol.kind = SolutionKind::Unique;
-        Matrix ref_A = es.R.col_range(0, A.cols());
-        Vector ref_b = es.R.column(A.cols());
-        Vector x = back_substitute_unique(ref_A, ref_b);
-        sol.particular = x;
+std::vector<Vector> LinearSystemSolution::directions() const {
+    std::vector<Vector> dirs;
+    dirs.reserve(null_space.cols());
+    for (std::size_t j = 0; j < null_space.cols(); ++j) {
+        dirs.push_back(null_space.column(j));
     }
+    return dirs;
+}
 
-    else {
-        sol.kind = SolutionKind::Infinite;
-        auto result = back_substitute_parametric(es.R, es.pivots);
-        sol.particular = result.particular;
-        sol.directions = result.directions;
+LinearSystemSolution solve(const Matrix &A, const Vector &b) {
+    check_rhs_rows(A, b.size());
+
+    // A and b are reduced side by side; no augmented [A | b] is built.
+    Matrix R = A;
+    Matrix B(A.rows(), 1, b);
+    PivotInfo pivots;
+    ref_inplace(R, B, pivots);
+
+    LinearSystemSolution sol;
+    if (pivots.free_cols.empty() && !is_inconsistent(B, 0, pivots)) {
+        sol.kind = SolutionKind::Unique;
+        // Read U and its right-hand side straight out of the reduced pair
+        // instead of col_range copies.
+        const std::size_t n = A.cols();
+        TriangularMatrix U = leading_triangle(R, n, Triangle::Upper);
+        Vector rhs(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            rhs[i] = B(i, 0);
+        }
+        sol.particular = back_substitute_unique(U, rhs);
+        sol.null_space.assign(n, 0);
+        return sol;
     }
+    solution_from_ref(R, B, 0, pivots, sol);
     return sol;
 }
 
+std::vector<LinearSystemSolution> solve_many(const Matrix &A,
+                                             const Matrix &B) {
+    check_rhs_rows(A, B.rows());
+
+    Matrix R = A;
+    Matrix X = B;
+    PivotInfo pivots;
+    ref_inplace(R, X, pivots);
+
+    std::vector<LinearSystemSolution> sols(B.cols());
+    if (!pivots.free_cols.empty()) {
+        for (std::size_t j = 0; j < B.cols(); ++j) {
+            solution_from_ref(R, X, j, pivots, sols[j]);
+        }
+        return sols;
+    }
+
+    // Full column rank: one triangular solve covers every right-hand side.
+    // Columns found inconsistent are solved too and then discarded.
+    const std::size_t n = A.cols();
+    TriangularMatrix U = leading_triangle(R, n, Triangle::Upper);
+    Matrix Y = trsm(U, X.row_range(0, n));
+    for (std::size_t j = 0; j < B.cols(); ++j) {
+        if (is_inconsistent(X, j, pivots)) {
+            solution_from_ref(R, X, j, pivots, sols[j]);
+            continue;
+        }
+        sols[j].kind = SolutionKind::Unique;
+        sols[j].particular = Y.column(j);
+        sols[j].null_space.assign(n, 0);
+    }
+    return sols;
+}
+
+void solve(const Matrix &A, const Vector &b, LinearSystemSolution &sol,
+           Workspace &ws) {
+    const std::size_t m = A.rows();
+    check_rhs_rows(A, b.size());
+
+    ws.reset();
+    Matrix &R = ws.copy(A);
+    Matrix &B = ws.matrix(m, 1);
+    for (std::size_t i = 0; i < m; ++i) {
+        B(i, 0) = b[i];
+    }
+
+    PivotInfo &pivots = ws.pivots();
+    ref_inplace(R, B, pivots);
+    solution_from_ref(R, B, 0, pivots, sol);
+}
+
+SolutionKind n_solutions(const Matrix &A, const Vector &b) {
+    check_rhs_rows(A, b.size());
+
+    Matrix R = A;
+    Matrix B(A.rows(), 1, b);
+    PivotInfo pivots;
+    ref_inplace(R, B, pivots);
+
+    if (is_inconsistent(B, 0, pivots)) {
+        return SolutionKind::None;
+    }
+    // Consistent: unique without free variables, infinite with them.
+    return pivots.free_cols.empty() ? SolutionKind::Unique
+                                    : SolutionKind::Infinite;
+}
+
 // This is my old Gauss-Jordan implementation, which I have replaced
 // by the more efficient Gaussian elimination in solve().
 // Keeping this as a reminder for how Gauss-Jordan can be implemented.
@@ -226,7 +300,7 @@ LinearSystemSolution solve_gauss_jordan(const Matrix &A, const Vector &b) {
         sol.kind = SolutionKind::Infinite;
         auto result = extract_parametric(es.R);
         sol.particular = result.particular;
-        sol.directions = result.directions;
+        sol.null_space = std::move(result.null_space);
     }
     return sol;
 }
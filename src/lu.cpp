@@ -0,0 +1,362 @@
+#include "la/lu.hpp"
+#include "math_utils/math_utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace la {
+namespace {
+// Below this rcond the Woodbury capacitance system is not trusted and the
+// matrix is refactored instead.
+constexpr double kMinCapacitanceRcond = 1e-8;
+
+// Doolittle elimination with partial pivoting in place: L (unit diagonal)
+// below and U on and above the diagonal, PA = LU.  Returns false as soon as
+// a pivot is effectively zero relative to the largest entry of A.
+bool factor_inplace(Matrix &A, Permutation &p) {
+    const std::size_t n = A.rows();
+    p = Permutation(n);
+
+    double scale = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            scale = std::max(scale, std::fabs(A(i, j)));
+        }
+    }
+
+    for (std::size_t k = 0; k < n; ++k) {
+        std::size_t piv = k;
+        for (std::size_t i = k + 1; i < n; ++i) {
+            if (std::fabs(A(i, k)) > std::fabs(A(piv, k))) {
+                piv = i;
+            }
+        }
+        if (math_utils::is_effectively_zero(A(piv, k), scale)) {
+            return false;
+        }
+        if (piv != k) {
+            A.exchange_rows(k, piv);
+            p.swap(k, piv);
+        }
+
+        const double d = A(k, k);
+        for (std::size_t i = k + 1; i < n; ++i) {
+            const double l = A(i, k) /= d;
+            if (l == 0.0)
+                continue;
+            for (std::size_t j = k + 1; j < n; ++j) {
+                A(i, j) -= l * A(k, j);
+            }
+        }
+    }
+    return true;
+}
+
+// Factor A into f.  The elimination runs on a scratch copy of A, which is
+// then split into the packed triangles.  Returns false if A is singular;
+// f is left empty then.
+bool factor(Matrix A, LU::Factors &f) {
+    const std::size_t n = A.rows();
+    if (!factor_inplace(A, f.p)) {
+        f.lower = TriangularMatrix(0, Triangle::Lower);
+        f.upper = TriangularMatrix(0, Triangle::Upper);
+        return false;
+    }
+    f.lower = TriangularMatrix(n, Triangle::Lower);
+    for (std::size_t i = 0; i < n; ++i) {
+        double *row = f.lower.row_data(i);
+        for (std::size_t j = 0; j < i; ++j) {
+            row[j] = A(i, j);
+        }
+        row[i] = 1.0;
+    }
+    f.upper = leading_triangle(A, n, Triangle::Upper);
+    return true;
+}
+
+// Columns c0, c0 + 1, ... of X := P B, the rows of B in the order of p.
+void permuted_rows_into(const Matrix &B, const Permutation &p, Matrix &X,
+                        std::size_t c0) {
+    for (std::size_t i = 0; i < B.rows(); ++i) {
+        for (std::size_t c = 0; c < B.cols(); ++c) {
+            X(i, c0 + c) = B(p[i], c);
+        }
+    }
+}
+
+// Columns [c0, c1) of X := U^{-1} L^{-1} X in place, X already permuted.
+// Whole rows of X are combined, as in the Cholesky solve.
+void triangular_solves(const LU::Factors &f, Matrix &X, std::size_t c0,
+                       std::size_t c1) {
+    const std::size_t n = f.lower.rows();
+    for (std::size_t i = 0; i < n; ++i) {
+        const double *li = f.lower.row_data(i);
+        for (std::size_t j = 0; j < i; ++j) {
+            const double l = li[j];
+            if (l == 0.0)
+                continue;
+            for (std::size_t c = c0; c < c1; ++c) {
+                X(i, c) -= l * X(j, c);
+            }
+        }
+    }
+    // Row i of the packed U starts at the diagonal.
+    for (std::size_t i = n; i-- > 0;) {
+        const double *ui = f.upper.row_data(i);
+        for (std::size_t j = i + 1; j < n; ++j) {
+            const double u = ui[j - i];
+            if (u == 0.0)
+                continue;
+            for (std::size_t c = c0; c < c1; ++c) {
+                X(i, c) -= u * X(j, c);
+            }
+        }
+        for (std::size_t c = c0; c < c1; ++c) {
+            X(i, c) /= ui[0];
+        }
+    }
+}
+
+double determinant_factored(const LU::Factors &f) {
+    double det = f.p.sign();
+    for (std::size_t i = 0; i < f.upper.rows(); ++i) {
+        det *= f.upper.row_data(i)[0];
+    }
+    return det;
+}
+
+double rcond_factored(const LU::Factors &f) {
+    const TriangularMatrix &U = f.upper;
+    if (U.rows() == 0)
+        return 1.0;
+    double lo = std::fabs(U.row_data(0)[0]);
+    double hi = lo;
+    for (std::size_t i = 1; i < U.rows(); ++i) {
+        lo = std::min(lo, std::fabs(U.row_data(i)[0]));
+        hi = std::max(hi, std::fabs(U.row_data(i)[0]));
+    }
+    return lo / hi;
+}
+} // namespace
+
+LU::LU(const Matrix &A) : a_(A) {
+    if (A.rows() != A.cols()) {
+        throw std::invalid_argument("LU: matrix must be square");
+    }
+    refactor();
+}
+
+// The correction buffers are kept for the next updates.
+void LU::refactor() {
+    singular_ = !factor(a_, base_);
+    rank_ = 0;
+    cap_ = Factors();
+}
+
+double LU::rcond() const noexcept {
+    return singular_ ? 0.0 : rcond_factored(base_);
+}
+
+Vector LU::solve(const Vector &b) const {
+    if (b.size() != size()) {
+        throw std::invalid_argument("LU::solve: size of b must match A");
+    }
+    if (singular_ || correction_rank() > 0) {
+        Matrix X = solve(Matrix(size(), std::size_t{1}, b));
+        return X.column(0);
+    }
+    return trsv(base_.upper, trsv(base_.lower, permute(b, base_.p)));
+}
+
+Matrix LU::solve(const Matrix &B) const {
+    if (B.rows() != size()) {
+        throw std::invalid_argument("LU::solve: rows of B must match A");
+    }
+    if (singular_) {
+        throw std::domain_error("LU::solve: matrix is singular");
+    }
+    Matrix X;
+    Matrix T;
+    solve_into(B, X, T);
+    return X;
+}
+
+void LU::solve(const Vector &b, Vector &x, Workspace &ws) const {
+    const std::size_t n = size();
+    if (b.size() != n) {
+        throw std::invalid_argument("LU::solve: size of b must match A");
+    }
+    if (singular_) {
+        throw std::domain_error("LU::solve: matrix is singular");
+    }
+    ws.reset();
+    Matrix &B = ws.matrix(n, 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        B(i, 0) = b[i];
+    }
+    Matrix &X = ws.matrix(n, 1);
+    solve_into(B, X, ws.matrix(0, 0));
+    x.assign(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = X(i, 0);
+    }
+}
+
+void LU::solve(const Matrix &B, Matrix &X, Workspace &ws) const {
+    if (B.rows() != size()) {
+        throw std::invalid_argument("LU::solve: rows of B must match A");
+    }
+    if (singular_) {
+        throw std::domain_error("LU::solve: matrix is singular");
+    }
+    ws.reset();
+    solve_into(B, X, ws.matrix(0, 0));
+}
+
+void LU::solve_into(const Matrix &B, Matrix &X, Matrix &T) const {
+    const std::size_t n = size();
+    const std::size_t m = B.cols();
+    X.assign(n, m);
+    permuted_rows_into(B, base_.p, X, 0);
+    triangular_solves(base_, X, 0, m);
+    if (rank_ == 0) {
+        return;
+    }
+
+    // Woodbury: A^{-1} = A0^{-1} - Z C^{-1} V^T A0^{-1}, C = I + V^T Z.
+    // T = V^T X is formed directly in the row order of C's factors.
+    const Permutation &q = cap_.p;
+    T.assign(rank_, m);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t t = 0; t < rank_; ++t) {
+            const double v = v_(i, q[t]);
+            if (v == 0.0)
+                continue;
+            for (std::size_t c = 0; c < m; ++c) {
+                T(t, c) += v * X(i, c);
+            }
+        }
+    }
+    triangular_solves(cap_, T, 0, m);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t t = 0; t < rank_; ++t) {
+            const double z = z_(i, t);
+            if (z == 0.0)
+                continue;
+            for (std::size_t c = 0; c < m; ++c) {
+                X(i, c) -= z * T(t, c);
+            }
+        }
+    }
+}
+
+double LU::determinant() const {
+    if (singular_) {
+        return 0.0;
+    }
+    // Matrix determinant lemma: det(A0 + U V^T) = det(A0) det(C).
+    double det = determinant_factored(base_);
+    if (correction_rank() > 0) {
+        det *= determinant_factored(cap_);
+    }
+    return det;
+}
+
+void LU::update(const Vector &u, const Vector &v) {
+    if (u.size() != size() || v.size() != size()) {
+        throw std::invalid_argument(
+            "LU::update: u and v must have as many entries as A has rows");
+    }
+    const std::size_t one = 1;
+    update(Matrix(size(), one, u), Matrix(size(), one, v));
+}
+
+void LU::update(const Matrix &U, const Matrix &V) {
+    const std::size_t n = size();
+    const std::size_t k = U.cols();
+    if (U.rows() != n || V.rows() != n || V.cols() != k) {
+        throw std::invalid_argument(
+            "LU::update: U and V must both be n x k for an n x n matrix");
+    }
+    if (k == 0) {
+        return;
+    }
+
+    // Keep A itself current for the next refactor: A += U V^T.
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t t = 0; t < k; ++t) {
+            const double u = U(i, t);
+            if (u == 0.0)
+                continue;
+            for (std::size_t j = 0; j < n; ++j) {
+                a_(i, j) += u * V(j, t);
+            }
+        }
+    }
+
+    // Past n/4 columns, or once refactoring the K x K capacitance matrix
+    // costs more than the O(k n^2) of this update, start over.
+    const std::size_t cap = n / 4;
+    const std::size_t K = rank_ + k;
+    if (singular_ || K > cap || K * K * K > k * n * n) {
+        refactor();
+        return;
+    }
+    if (u_.cols() != cap) {
+        u_.assign(n, cap);
+        v_.assign(n, cap);
+        z_.assign(n, cap);
+        c_.assign(cap, cap);
+    }
+
+    // New columns rank_ .. K - 1: U, V and Z = A0^{-1} U, O(k n^2).
+    permuted_rows_into(U, base_.p, z_, rank_);
+    triangular_solves(base_, z_, rank_, K);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t t = 0; t < k; ++t) {
+            u_(i, rank_ + t) = U(i, t);
+            v_(i, rank_ + t) = V(i, t);
+        }
+    }
+
+    // Border C = I + V^T Z with its new rows and columns, O(n K k); the
+    // leading rank_ x rank_ block is unchanged.
+    for (std::size_t s = 0; s < K; ++s) {
+        for (std::size_t t = rank_; t < K; ++t) {
+            c_(s, t) = s == t ? 1.0 : 0.0;
+            c_(t, s) = s == t ? 1.0 : 0.0;
+        }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t s = 0; s < K; ++s) {
+            const double vs = v_(i, s);
+            if (vs == 0.0)
+                continue;
+            for (std::size_t t = rank_; t < K; ++t) {
+                c_(s, t) += vs * z_(i, t);
+            }
+        }
+        for (std::size_t t = rank_; t < K; ++t) {
+            const double vt = v_(i, t);
+            if (vt == 0.0)
+                continue;
+            for (std::size_t s = 0; s < rank_; ++s) {
+                c_(t, s) += vt * z_(i, s);
+            }
+        }
+    }
+    rank_ = K;
+
+    Matrix C(K, K);
+    for (std::size_t s = 0; s < K; ++s) {
+        for (std::size_t t = 0; t < K; ++t) {
+            C(s, t) = c_(s, t);
+        }
+    }
+    if (!factor(std::move(C), cap_) ||
+        rcond_factored(cap_) < kMinCapacitanceRcond) {
+        refactor(); // unreliable correction, or A became singular
+    }
+}
+} // namespace la
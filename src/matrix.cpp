@@ -1,4 +1,5 @@
 #include "la/matrix.hpp"
+#include "la/matrix_products.hpp"
 #include "la/vector.hpp"
 #include "la/vector_algorithms.hpp"
 #include "math_utils/math_utils.hpp"
@@ -30,7 +31,7 @@ Matrix::Matrix(std::size_t rows, std::size_t cols,
         throw std::out_of_range{
             "Matrix dimensions did not match with elements in data"};
     }
-    data_ = data; // Initialize data only after the check
+    data_.assign(data.begin(), data.end()); // only after the check
 }
 
 Matrix::Matrix(std::size_t rows, std::size_t cols, const Vector &v) {
@@ -90,29 +91,11 @@ Matrix Matrix::operator*(double c) const {
 }
 
 Matrix Matrix::operator*(const Matrix &m) const {
-    if (cols_ != m.rows()) {
-        throw std::invalid_argument(
-            "Left matrix columns must match right matrix rows");
-    }
-
-    Matrix result(rows_, m.cols());
-
-    for (size_t i = 0; i < rows_; i++) {
-        Vector r = row(i);
-
-        for (size_t j = 0; j < m.cols(); j++) {
-            Vector col = m.column(j);
-            result(i, j) = dot(r, col);
-        }
-    }
-
-    return result;
+    return multiply(*this, Op::None, m, Op::None);
 }
 
 Vector Matrix::operator*(const Vector &v) const {
-    Matrix col_matrix(v.size(), 1, v);
-    Matrix result = (*this) * col_matrix;
-    return result.column(0);
+    return multiply(*this, Op::None, v);
 }
 
 Vector Matrix::row(int i) const {
@@ -194,10 +177,12 @@ Matrix Matrix::col_range(std::size_t lower, std::size_t upper) const {
 }
 
 void Matrix::exchange_rows(std::size_t idx_a, std::size_t idx_b) {
-    Vector vector_a = row(idx_a);
-    Vector vector_b = row(idx_b);
-    set_row(idx_a, vector_b);
-    set_row(idx_b, vector_a);
+    if (idx_a >= rows_ || idx_b >= rows_)
+        throw std::out_of_range("exchange_rows: row index out of range");
+    if (idx_a == idx_b)
+        return;
+    double *a = pointer_to_row_unchecked(idx_a);
+    std::swap_ranges(a, a + cols_, pointer_to_row_unchecked(idx_b));
 }
 
 bool approx_equal(const Matrix &A, const Matrix &B, double abs_tol,
@@ -1,8 +1,48 @@
 #include "la/matrix_linear_systems.hpp"
+#include "la/eliminated_system.hpp"
 #include "la/row_reduction.hpp"
 #include "la/vector_algorithms.hpp"
 
 namespace la {
+namespace {
+// Reduce R alongside the right-hand sides B (both scratch copies) and
+// report for each column of B whether it lies in the column space of R.
+std::vector<bool> columns_in_span(Matrix &R, Matrix &B) {
+    PivotInfo pivots;
+    ref_inplace(R, B, pivots);
+    std::vector<bool> in_span(B.cols());
+    for (std::size_t j = 0; j < B.cols(); ++j) {
+        in_span[j] = !is_inconsistent(B, j, pivots);
+    }
+    return in_span;
+}
+
+const Vector &as_vector(const Vector &v) { return v; }
+const Vector &as_vector(const SharedVector &v) { return v.get(); }
+
+// from_cols() for plain or shared vectors: one column per vector, 0x0 if
+// there are none.
+template <typename Vectors> Matrix column_matrix(const Vectors &vectors) {
+    if (vectors.empty())
+        return Matrix(0, 0);
+
+    const std::size_t m = as_vector(vectors[0]).size();
+    for (const auto &v : vectors) {
+        if (as_vector(v).size() != m)
+            throw std::invalid_argument("vector sizes must match");
+    }
+
+    Matrix A(m, vectors.size());
+    for (std::size_t j = 0; j < vectors.size(); ++j) {
+        const Vector &v = as_vector(vectors[j]);
+        for (std::size_t i = 0; i < m; ++i) {
+            A(i, j) = v[i];
+        }
+    }
+    return A;
+}
+} // namespace
+
 Matrix augment(const Matrix &A, const Vector &b) {
     const std::size_t m = A.rows();
     const std::size_t n = A.cols();
@@ -48,17 +88,39 @@ bool is_in_span(const std::vector<Vector> &vectors, const Vector &b) {
     return is_in_span(A, b);
 }
 
+bool is_in_span(const std::vector<SharedVector> &vectors, const Vector &b) {
+    Matrix A = column_matrix(vectors);
+    if (b.size() != A.rows()) {
+        throw std::invalid_argument(
+            "Size of b must match the sizes of vectors");
+    }
+    // A is already a private copy, so it is reduced in place.
+    Matrix B(b.size(), 1, b);
+    return columns_in_span(A, B)[0];
+}
+
 bool is_in_span(const Matrix &A, const Vector &b) {
     if (b.size() != A.rows()) {
         throw std::invalid_argument(
             "Size of b must match the sizes of vectors");
     }
 
-    auto r1 = la::rank(A);
-    Matrix Ab = la::augment(A, b);
-    auto r2 = la::rank(Ab);
+    // One elimination of A with b carried along; b is in the span iff the
+    // system A|b is consistent.
+    Matrix R = A;
+    Matrix B(b.size(), 1, b);
+    return columns_in_span(R, B)[0];
+}
 
-    return r1 == r2;
+std::vector<bool> are_in_span(const Matrix &A, const Matrix &B) {
+    if (B.rows() != A.rows()) {
+        throw std::invalid_argument(
+            "Row count of B must match the sizes of vectors");
+    }
+
+    Matrix R = A;
+    Matrix X = B;
+    return columns_in_span(R, X);
 }
 
 bool is_linear_combination(const Matrix &B,
@@ -73,31 +135,60 @@ bool is_linear_combination(const Matrix &B,
         }
     }
 
-    std::vector<Vector> column_vectors;
-    column_vectors.reserve(matrices.size());
-
-    for (std::size_t n = 0; n < matrices.size(); n++) {
-        column_vectors.push_back(flatten(matrices.at(n)));
+    // Column t of A is matrices[t] read in row-major order, b is B read
+    // the same way; both are filled directly instead of via flatten().
+    const std::size_t size = B.rows() * B.cols();
+    Matrix A(size, matrices.size());
+    Matrix b(size, std::size_t{1});
+    for (std::size_t i = 0; i < B.rows(); ++i) {
+        for (std::size_t j = 0; j < B.cols(); ++j) {
+            const std::size_t row = i * B.cols() + j;
+            for (std::size_t t = 0; t < matrices.size(); ++t) {
+                A(row, t) = matrices[t](i, j);
+            }
+            b(row, 0) = B(i, j);
+        }
     }
-
-    return is_in_span(column_vectors, flatten(B));
+    return columns_in_span(A, b)[0];
 }
 
-bool are_linearly_independent(const std::vector<Matrix> &matrices) {
+namespace {
+const Matrix &as_matrix(const Matrix &M) { return M; }
+const Matrix &as_matrix(const SharedMatrix &M) { return M.get(); }
+
+template <typename Matrices>
+bool matrices_are_linearly_independent(const Matrices &matrices) {
     if (matrices.empty())
         return true;
 
+    const Matrix &first = as_matrix(matrices[0]);
     for (std::size_t i = 0; i < matrices.size(); i++) {
-        if (!matrices[i].has_same_dimensions(matrices[0])) {
+        if (!as_matrix(matrices[i]).has_same_dimensions(first)) {
             throw std::invalid_argument("Sizes of matrices must match");
         }
     }
 
     std::vector<Vector> column_vectors;
+    column_vectors.reserve(matrices.size());
     for (const auto &M : matrices) {
-        column_vectors.push_back(flatten(M));
+        column_vectors.push_back(flatten(as_matrix(M)));
     }
 
     return are_linearly_independent(column_vectors);
 }
+} // namespace
+
+bool are_linearly_independent(const std::vector<Matrix> &matrices) {
+    return matrices_are_linearly_independent(matrices);
+}
+
+bool are_linearly_independent(const std::vector<SharedMatrix> &matrices) {
+    return matrices_are_linearly_independent(matrices);
+}
+
+bool are_linearly_independent(const std::vector<SharedVector> &vectors) {
+    Matrix A = column_matrix(vectors);
+    ref_inplace(A);
+    return rank_from_ref(A) == vectors.size();
+}
 } // namespace la
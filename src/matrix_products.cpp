@@ -0,0 +1,167 @@
+#include "la/matrix_products.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace la {
+namespace {
+// Tile edge for the output triangle; a 64 x 64 tile of doubles is 32 KiB.
+constexpr std::size_t kGramBlock = 64;
+
+std::size_t op_rows(const Matrix &A, Op op) {
+    return op == Op::None ? A.rows() : A.cols();
+}
+
+std::size_t op_cols(const Matrix &A, Op op) {
+    return op == Op::None ? A.cols() : A.rows();
+}
+
+void mirror_upper(Matrix &C) {
+    for (std::size_t i = 0; i < C.rows(); ++i) {
+        for (std::size_t j = i + 1; j < C.cols(); ++j) {
+            C(j, i) = C(i, j);
+        }
+    }
+}
+} // namespace
+
+Matrix multiply(const Matrix &A, Op op_a, const Matrix &B, Op op_b) {
+    const std::size_t m = op_rows(A, op_a);
+    const std::size_t k = op_cols(A, op_a);
+    const std::size_t n = op_cols(B, op_b);
+    if (op_rows(B, op_b) != k) {
+        throw std::invalid_argument(
+            "Left matrix columns must match right matrix rows");
+    }
+
+    Matrix C(m, n);
+
+    if (op_a == Op::None && op_b == Op::None) {
+        // C(i, :) += A(i, p) B(p, :)
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t p = 0; p < k; ++p) {
+                const double a = A(i, p);
+                for (std::size_t j = 0; j < n; ++j) {
+                    C(i, j) += a * B(p, j);
+                }
+            }
+        }
+    } else if (op_a == Op::Transpose && op_b == Op::None) {
+        // C(i, :) += A(p, i) B(p, :), streaming the shared rows p
+        for (std::size_t p = 0; p < k; ++p) {
+            for (std::size_t i = 0; i < m; ++i) {
+                const double a = A(p, i);
+                for (std::size_t j = 0; j < n; ++j) {
+                    C(i, j) += a * B(p, j);
+                }
+            }
+        }
+    } else if (op_a == Op::None && op_b == Op::Transpose) {
+        // C(i, j) = A(i, :) . B(j, :)
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                double sum = 0.0;
+                for (std::size_t p = 0; p < k; ++p) {
+                    sum += A(i, p) * B(j, p);
+                }
+                C(i, j) = sum;
+            }
+        }
+    } else {
+        // C(i, j) = sum_p A(p, i) B(j, p); walk rows of A for each row of B
+        for (std::size_t j = 0; j < n; ++j) {
+            for (std::size_t p = 0; p < k; ++p) {
+                const double b = B(j, p);
+                for (std::size_t i = 0; i < m; ++i) {
+                    C(i, j) += A(p, i) * b;
+                }
+            }
+        }
+    }
+
+    return C;
+}
+
+Vector multiply(const Matrix &A, Op op_a, const Vector &x) {
+    if (x.size() != op_cols(A, op_a)) {
+        throw std::invalid_argument(
+            "Vector size must match the columns of the matrix");
+    }
+
+    Vector y(op_rows(A, op_a));
+    if (op_a == Op::None) {
+        for (std::size_t i = 0; i < A.rows(); ++i) {
+            double sum = 0.0;
+            for (std::size_t j = 0; j < A.cols(); ++j) {
+                sum += A(i, j) * x[j];
+            }
+            y[i] = sum;
+        }
+    } else {
+        // y += x[p] A(p, :), so A^T x reads A along its rows
+        for (std::size_t p = 0; p < A.rows(); ++p) {
+            const double xp = x[p];
+            for (std::size_t j = 0; j < A.cols(); ++j) {
+                y[j] += xp * A(p, j);
+            }
+        }
+    }
+    return y;
+}
+
+Matrix gram(const Matrix &A) {
+    const std::size_t m = A.rows();
+    const std::size_t n = A.cols();
+    Matrix C(n, n);
+
+    // C(i, j) = sum_p A(p, i) A(p, j).  For each upper tile, stream the rows
+    // of A and add the rank-one contribution of row p to the tile, so both
+    // A and C are walked along contiguous rows.
+    for (std::size_t ib = 0; ib < n; ib += kGramBlock) {
+        const std::size_t ie = std::min(ib + kGramBlock, n);
+        for (std::size_t jb = ib; jb < n; jb += kGramBlock) {
+            const std::size_t je = std::min(jb + kGramBlock, n);
+            for (std::size_t p = 0; p < m; ++p) {
+                for (std::size_t i = ib; i < ie; ++i) {
+                    const double a = A(p, i);
+                    for (std::size_t j = std::max(jb, i); j < je; ++j) {
+                        C(i, j) += a * A(p, j);
+                    }
+                }
+            }
+        }
+    }
+
+    mirror_upper(C);
+    return C;
+}
+
+Matrix outer_gram(const Matrix &A) {
+    const std::size_t m = A.rows();
+    const std::size_t k = A.cols();
+    Matrix C(m, m);
+
+    // C(i, j) = row i . row j.  Tiles over (i, j) keep a block of rows hot,
+    // and the shared dimension is consumed in chunks of the same size.
+    for (std::size_t ib = 0; ib < m; ib += kGramBlock) {
+        const std::size_t ie = std::min(ib + kGramBlock, m);
+        for (std::size_t jb = ib; jb < m; jb += kGramBlock) {
+            const std::size_t je = std::min(jb + kGramBlock, m);
+            for (std::size_t pb = 0; pb < k; pb += kGramBlock) {
+                const std::size_t pe = std::min(pb + kGramBlock, k);
+                for (std::size_t i = ib; i < ie; ++i) {
+                    for (std::size_t j = std::max(jb, i); j < je; ++j) {
+                        double sum = 0.0;
+                        for (std::size_t p = pb; p < pe; ++p) {
+                            sum += A(i, p) * A(j, p);
+                        }
+                        C(i, j) += sum;
+                    }
+                }
+            }
+        }
+    }
+
+    mirror_upper(C);
+    return C;
+}
+} // namespace la
@@ -1,21 +1,191 @@
 #include "la/matrix_transforms.hpp"
-#include "la/approx.hpp"
+#include "la/lu.hpp"
 #include "la/matrix.hpp"
-#include "la/matrix_linear_systems.hpp"
-#include "la/row_reduction.hpp"
+#include "la/matrix_products.hpp"
 #include "math_utils/math_utils.hpp"
+#include "utils/joining_threads.hpp"
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace la {
+namespace {
+// Below this many elements a tile is copied directly.
+constexpr std::size_t kTransposeLeaf = 256;
+
+// Below this rcond the Woodbury correction of update_inverse is rejected.
+constexpr double kMinCapacitanceRcond = 1e-8;
+
+// Below this many elements transpose_parallel stays on the calling thread.
+constexpr std::size_t kParallelTransposeMin = 1 << 16;
+
+// T[c0, c1) x [r0, r1) = A[r0, r1) x [c0, c1)^T, splitting the longer side
+// in half until the tile is small.
+void transpose_tile(const Matrix &A, Matrix &T, std::size_t r0,
+                    std::size_t r1, std::size_t c0, std::size_t c1) {
+    const std::size_t rows = r1 - r0;
+    const std::size_t cols = c1 - c0;
+    if (rows * cols <= kTransposeLeaf) {
+        for (std::size_t i = r0; i < r1; ++i) {
+            for (std::size_t j = c0; j < c1; ++j) {
+                T(j, i) = A(i, j);
+            }
+        }
+    } else if (rows >= cols) {
+        const std::size_t mid = r0 + rows / 2;
+        transpose_tile(A, T, r0, mid, c0, c1);
+        transpose_tile(A, T, mid, r1, c0, c1);
+    } else {
+        const std::size_t mid = c0 + cols / 2;
+        transpose_tile(A, T, r0, r1, c0, mid);
+        transpose_tile(A, T, r0, r1, mid, c1);
+    }
+}
+
+// Swap A[r0, r1) x [c0, c1) with the mirrored block A[c0, c1) x [r0, r1)^T.
+// The two blocks must not overlap.
+void swap_mirrored(Matrix &A, std::size_t r0, std::size_t r1, std::size_t c0,
+                   std::size_t c1) {
+    const std::size_t rows = r1 - r0;
+    const std::size_t cols = c1 - c0;
+    if (rows * cols <= kTransposeLeaf) {
+        for (std::size_t i = r0; i < r1; ++i) {
+            for (std::size_t j = c0; j < c1; ++j) {
+                std::swap(A(i, j), A(j, i));
+            }
+        }
+    } else if (rows >= cols) {
+        const std::size_t mid = r0 + rows / 2;
+        swap_mirrored(A, r0, mid, c0, c1);
+        swap_mirrored(A, mid, r1, c0, c1);
+    } else {
+        const std::size_t mid = c0 + cols / 2;
+        swap_mirrored(A, r0, r1, c0, mid);
+        swap_mirrored(A, r0, r1, mid, c1);
+    }
+}
+
+// Transpose the diagonal block [b0, b1) x [b0, b1) in place: transpose both
+// diagonal halves, then exchange the off-diagonal quadrants.
+void transpose_diagonal(Matrix &A, std::size_t b0, std::size_t b1) {
+    const std::size_t n = b1 - b0;
+    if (n * n <= kTransposeLeaf) {
+        for (std::size_t i = b0; i < b1; ++i) {
+            for (std::size_t j = i + 1; j < b1; ++j) {
+                std::swap(A(i, j), A(j, i));
+            }
+        }
+        return;
+    }
+    const std::size_t mid = b0 + n / 2;
+    transpose_diagonal(A, b0, mid);
+    transpose_diagonal(A, mid, b1);
+    swap_mirrored(A, mid, b1, b0, mid);
+}
+
+// In-place Gauss-Jordan with partial pivoting; swapped_with is scratch for
+// the row interchanges.
+bool invert_gauss_jordan(Matrix &A, std::vector<std::size_t> &swapped_with) {
+    const std::size_t n = A.rows();
+
+    double scale = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            scale = std::max(scale, std::fabs(A(i, j)));
+        }
+    }
+
+    swapped_with.resize(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        // Partial pivoting on column k.
+        std::size_t p = k;
+        for (std::size_t i = k + 1; i < n; ++i) {
+            if (std::fabs(A(i, k)) > std::fabs(A(p, k))) {
+                p = i;
+            }
+        }
+        if (math_utils::is_effectively_zero(A(p, k), scale)) {
+            return false;
+        }
+        swapped_with[k] = p;
+        if (p != k) {
+            A.exchange_rows(k, p);
+        }
+
+        // Column k of the identity is implicit: store the pivot's
+        // reciprocal in its place and scale the rest of the row.
+        const double pivot = A(k, k);
+        A(k, k) = 1.0;
+        for (std::size_t j = 0; j < n; ++j) {
+            A(k, j) /= pivot;
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (i == k)
+                continue;
+            const double factor = A(i, k);
+            if (factor == 0.0)
+                continue;
+            A(i, k) = 0.0;
+            for (std::size_t j = 0; j < n; ++j) {
+                A(i, j) -= factor * A(k, j);
+            }
+        }
+    }
+
+    // A row interchange of the input is a column interchange of the inverse.
+    for (std::size_t k = n; k-- > 0;) {
+        const std::size_t p = swapped_with[k];
+        if (p == k)
+            continue;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::swap(A(i, k), A(i, p));
+        }
+    }
+
+    return true;
+}
+} // namespace
+
 Matrix transpose(const Matrix &A) {
-    std::size_t m = A.rows();
-    std::size_t n = A.cols();
-    Matrix T(n, m);
+    Matrix T(A.cols(), A.rows());
+    transpose_tile(A, T, 0, A.rows(), 0, A.cols());
+    return T;
+}
 
-    for (std::size_t i = 0; i < m; i++) {
-        auto v = A.row(i);
-        T.set_col(i, v);
+void transpose_inplace(Matrix &A) {
+    if (A.rows() != A.cols()) {
+        throw std::invalid_argument(
+            "transpose_inplace: matrix must be square");
+    }
+    transpose_diagonal(A, 0, A.rows());
+}
+
+Matrix transpose_parallel(const Matrix &A, unsigned n_threads) {
+    const std::size_t m = A.rows();
+    const std::size_t n = A.cols();
+    if (n_threads == 0) {
+        n_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (n_threads == 1 || m * n < kParallelTransposeMin || n < 2) {
+        return transpose(A);
     }
 
+    // Each thread owns a stripe of rows of T (= columns of A), so the
+    // writes never overlap.
+    Matrix T(n, m);
+    const std::size_t stripes = std::min<std::size_t>(n_threads, n);
+    {
+        utils::JoiningThreads workers(stripes);
+        for (std::size_t s = 0; s < stripes; ++s) {
+            const std::size_t c0 = n * s / stripes;
+            const std::size_t c1 = n * (s + 1) / stripes;
+            workers.spawn([&A, &T, m, c0, c1]() {
+                transpose_tile(A, T, 0, m, c0, c1);
+            });
+        }
+    }
     return T;
 }
 
@@ -46,26 +216,80 @@ bool is_symmetric(const Matrix &A) {
 }
 
 bool inverse(const Matrix &in, Matrix &out) {
-    std::size_t n = in.rows();
+    if (in.cols() != in.rows()) {
+        throw std::invalid_argument("The matrix in must be square");
+    }
+
+    // Work on a copy so out is only touched when in is invertible.
+    Matrix work = in;
+    if (!inverse_inplace(work)) {
+        return false;
+    }
+    out = std::move(work);
+    return true;
+}
 
-    if (in.cols() != n) {
+bool inverse(const Matrix &in, Matrix &out, Workspace &ws) {
+    if (in.cols() != in.rows()) {
         throw std::invalid_argument("The matrix in must be square");
     }
 
-    // This is not the most performant way to calculate inverse,
-    // but this matches Poole section 3.3. Gauss-Jordan method.
-    Matrix augmented = augment(in, identity(n));
-    Matrix reduced = rref(augmented);
-    Matrix left = reduced.col_range(0, n);
+    ws.reset();
+    Matrix &work = ws.copy(in);
+    std::vector<std::size_t> &swapped_with = ws.indices();
+    if (!invert_gauss_jordan(work, swapped_with)) {
+        return false;
+    }
+    out = work; // copy-assignment reuses out's buffer
+    return true;
+}
+
+bool inverse_inplace(Matrix &A) {
+    if (A.cols() != A.rows()) {
+        throw std::invalid_argument("The matrix in must be square");
+    }
+    std::vector<std::size_t> swapped_with;
+    return invert_gauss_jordan(A, swapped_with);
+}
 
-    // Check that left is identity
-    if (approx_equal(left, identity(n), math_utils::kDefaultAbsTol,
-                     math_utils::kDefaultRelTol)) {
-        // Extract right-hand side to result
-        out = reduced.col_range(n, n * 2);
+bool update_inverse(Matrix &Ainv, const Matrix &U, const Matrix &V) {
+    const std::size_t n = Ainv.rows();
+    const std::size_t k = U.cols();
+    if (Ainv.cols() != n) {
+        throw std::invalid_argument("update_inverse: Ainv must be square");
+    }
+    if (U.rows() != n || V.rows() != n || V.cols() != k) {
+        throw std::invalid_argument(
+            "update_inverse: U and V must both be n x k");
+    }
+    if (k == 0) {
         return true;
     }
 
-    return false;
+    // (A + U V^T)^{-1} = Ainv - Z C^{-1} W with Z = Ainv U, W = V^T Ainv
+    // and the k x k capacitance matrix C = I + V^T Z.
+    const Matrix Z = multiply(Ainv, Op::None, U, Op::None);
+    Matrix C = multiply(V, Op::Transpose, Z, Op::None);
+    for (std::size_t i = 0; i < k; ++i) {
+        C(i, i) += 1.0;
+    }
+    const LU cap(C);
+    if (cap.is_singular() || cap.rcond() < kMinCapacitanceRcond) {
+        return false;
+    }
+    const Matrix T = cap.solve(multiply(V, Op::Transpose, Ainv, Op::None));
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t t = 0; t < k; ++t) {
+            const double z = Z(i, t);
+            if (z == 0.0)
+                continue;
+            for (std::size_t j = 0; j < n; ++j) {
+                Ainv(i, j) -= z * T(t, j);
+            }
+        }
+    }
+    return true;
 }
+
 } // namespace la
@@ -1,4 +1,5 @@
 #include "la/parity.hpp"
+#include "la/check_digits.hpp"
 #include <bitset>
 #include <iterator>
 #include <numeric>
@@ -6,51 +7,74 @@
 
 namespace la {
 namespace {
-int upc_weighted_sum(const std::vector<int> &digits) {
+template <typename Scheme> int weighted_sum(const std::vector<int> &digits) {
     int s = 0;
     for (size_t i = 0; i < digits.size(); ++i)
-        s += (i % 2 == 0 ? 3 : 1) * digits[i];
+        s += static_cast<int>(Scheme::weight(i)) * digits[i];
     return s;
 }
-
-int isbn10_weighted_sum(const std::vector<int> &digits) {
-    int s = 0;
-    for (size_t i = 0; i < digits.size(); ++i)
-        s += ((10 - i) * digits[i]);
-    return s;
-}
-
 } // namespace
 
-int upc_check_digit(std::vector<int> v) {
+int upc_check_digit(const std::vector<int> &v) {
     if (v.size() != 11) {
         throw std::invalid_argument("UPC digits vector must be length 11");
     }
-    int s = upc_weighted_sum(v);
+    int s = weighted_sum<UpcA>(v);
     return modular_additive_inverse(s, 10);
 }
 
-bool upc_has_error(std::vector<int> v) {
+bool upc_has_error(const std::vector<int> &v) {
     if (v.size() != 12) {
         throw std::invalid_argument("UPC digits vector must be length 12");
     }
-    int s = upc_weighted_sum(v);
+    int s = weighted_sum<UpcA>(v);
     return !(s % 10 == 0);
 }
 
-int isbn10_check_digit(std::vector<int> v) {
+int isbn10_check_digit(const std::vector<int> &v) {
     if (v.size() != 9) {
         throw std::invalid_argument("ISBN digits vector must be length 9");
     }
-    int s = isbn10_weighted_sum(v);
+    int s = weighted_sum<Isbn10>(v);
     return modular_additive_inverse(s, 11);
 }
 
-bool isbn10_has_error(std::vector<int> v) {
+bool isbn10_has_error(const std::vector<int> &v) {
     if (v.size() != 10) {
         throw std::invalid_argument("ISBN digits vector must be length 10");
     }
-    int s = isbn10_weighted_sum(v);
+    int s = weighted_sum<Isbn10>(v);
     return !(s % 11 == 0);
 }
+
+std::size_t upc_find_errors(const char *codes, std::size_t count,
+                            std::size_t stride, BitVector &failed) {
+    return find_code_errors<UpcA>(codes, count, stride, failed);
+}
+
+std::size_t upc_find_errors(const char *codes, std::size_t count,
+                            std::size_t stride,
+                            std::vector<std::size_t> &failures) {
+    return find_code_errors<UpcA>(codes, count, stride, failures);
+}
+
+std::size_t upc_complete(char *codes, std::size_t count, std::size_t stride) {
+    return complete_codes<UpcA>(codes, count, stride);
+}
+
+std::size_t isbn10_find_errors(const char *codes, std::size_t count,
+                               std::size_t stride, BitVector &failed) {
+    return find_code_errors<Isbn10>(codes, count, stride, failed);
+}
+
+std::size_t isbn10_find_errors(const char *codes, std::size_t count,
+                               std::size_t stride,
+                               std::vector<std::size_t> &failures) {
+    return find_code_errors<Isbn10>(codes, count, stride, failures);
+}
+
+std::size_t isbn10_complete(char *codes, std::size_t count,
+                            std::size_t stride) {
+    return complete_codes<Isbn10>(codes, count, stride);
+}
 } // namespace la
@@ -0,0 +1,161 @@
+#include "la/permutation.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace la {
+namespace {
+void check_size(std::size_t n, const Permutation &p, const char *what) {
+    if (n != p.size()) {
+        throw std::invalid_argument(what);
+    }
+}
+} // namespace
+
+Permutation::Permutation(std::size_t n) : indices_(n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        indices_[i] = i;
+    }
+}
+
+Permutation::Permutation(std::vector<std::size_t> indices)
+    : indices_(std::move(indices)) {
+    std::vector<bool> seen(indices_.size(), false);
+    for (std::size_t i = 0; i < indices_.size(); ++i) {
+        const std::size_t k = indices_[i];
+        if (k >= indices_.size() || seen[k]) {
+            throw std::invalid_argument(
+                "Permutation: indices must be a permutation of [0, n)");
+        }
+        seen[k] = true;
+    }
+}
+
+Permutation Permutation::inverse() const {
+    std::vector<std::size_t> inv(indices_.size());
+    for (std::size_t i = 0; i < indices_.size(); ++i) {
+        inv[indices_[i]] = i;
+    }
+    Permutation result;
+    result.indices_ = std::move(inv); // already validated
+    return result;
+}
+
+void Permutation::swap(std::size_t a, std::size_t b) {
+    if (a >= indices_.size() || b >= indices_.size()) {
+        throw std::out_of_range("Permutation::swap: index out of range");
+    }
+    std::swap(indices_[a], indices_[b]);
+}
+
+int Permutation::sign() const {
+    // Each cycle of length k is k - 1 transpositions.
+    std::vector<bool> visited(indices_.size(), false);
+    std::size_t transpositions = 0;
+    for (std::size_t i = 0; i < indices_.size(); ++i) {
+        for (std::size_t j = i; !visited[j]; j = indices_[j]) {
+            visited[j] = true;
+            if (indices_[j] != i) {
+                ++transpositions;
+            }
+        }
+    }
+    return transpositions % 2 == 0 ? 1 : -1;
+}
+
+Vector permute(const Vector &v, const Permutation &p) {
+    check_size(v.size(), p, "permute: vector size must match permutation");
+    Vector y(v.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+        y[i] = v[p[i]];
+    }
+    return y;
+}
+
+Vector unpermute(const Vector &v, const Permutation &p) {
+    check_size(v.size(), p, "unpermute: vector size must match permutation");
+    Vector y(v.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+        y[p[i]] = v[i];
+    }
+    return y;
+}
+
+Matrix permute_rows(const Matrix &A, const Permutation &p) {
+    check_size(A.rows(), p, "permute_rows: row count must match permutation");
+    Matrix B(A.rows(), A.cols());
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            B(i, j) = A(p[i], j);
+        }
+    }
+    return B;
+}
+
+void permute_rows_inplace(Matrix &A, const Permutation &p) {
+    check_size(A.rows(), p,
+               "permute_rows_inplace: row count must match permutation");
+    // Walking the cycle i -> p[i] -> p[p[i]] -> ... and swapping each row
+    // with its successor leaves every visited row holding its final content.
+    std::vector<bool> done(p.size(), false);
+    for (std::size_t i = 0; i < p.size(); ++i) {
+        if (done[i])
+            continue;
+        done[i] = true;
+        for (std::size_t j = i; p[j] != i; j = p[j]) {
+            A.exchange_rows(j, p[j]);
+            done[p[j]] = true;
+        }
+    }
+}
+
+Matrix unpermute_rows(const Matrix &A, const Permutation &p) {
+    check_size(A.rows(), p,
+               "unpermute_rows: row count must match permutation");
+    Matrix B(A.rows(), A.cols());
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            B(p[i], j) = A(i, j);
+        }
+    }
+    return B;
+}
+
+Matrix permute_cols(const Matrix &A, const Permutation &p) {
+    check_size(A.cols(), p,
+               "permute_cols: column count must match permutation");
+    Matrix B(A.rows(), A.cols());
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            B(i, j) = A(i, p[j]);
+        }
+    }
+    return B;
+}
+
+Matrix unpermute_cols(const Matrix &A, const Permutation &p) {
+    check_size(A.cols(), p,
+               "unpermute_cols: column count must match permutation");
+    Matrix B(A.rows(), A.cols());
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            B(i, p[j]) = A(i, j);
+        }
+    }
+    return B;
+}
+
+Matrix permute_symmetric(const Matrix &A, const Permutation &p) {
+    if (A.rows() != A.cols()) {
+        throw std::invalid_argument("permute_symmetric: matrix must be square");
+    }
+    check_size(A.rows(), p,
+               "permute_symmetric: matrix size must match permutation");
+    Matrix B(A.rows(), A.cols());
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            B(i, j) = A(p[i], p[j]);
+        }
+    }
+    return B;
+}
+} // namespace la
@@ -0,0 +1,155 @@
+#include "la/recursive_least_squares.hpp"
+#include "math_utils/math_utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace la {
+namespace {
+// A removal whose new diagonal entry keeps less than this fraction of the
+// old one (squared) has lost that direction; see Cholesky::downdate.
+constexpr double kMinDowndateRatio = 1e-8;
+
+// Fold x into the upper factor S with Givens rotations, S^T S + x x^T.
+// Row k of S is contiguous, so each rotation streams through memory.
+void givens_update(TriangularMatrix &S, std::vector<double> &x) {
+    const std::size_t m = S.rows();
+    for (std::size_t k = 0; k < m; ++k) {
+        double *s = S.row_data(k); // s[j - k] = S(k, j)
+        const double r = std::hypot(s[0], x[k]);
+        if (r == 0.0)
+            continue;
+        const double c = s[0] / r;
+        const double sn = x[k] / r;
+        s[0] = r;
+        for (std::size_t j = k + 1; j < m; ++j) {
+            const double t = s[j - k];
+            s[j - k] = c * t + sn * x[j];
+            x[j] = c * x[j] - sn * t;
+        }
+    }
+}
+
+// S^T S - x x^T with hyperbolic rotations.  The last diagonal entry is the
+// residual and may reach zero; any other that would vanish makes this fail.
+bool hyperbolic_downdate(TriangularMatrix &S, std::vector<double> &x) {
+    const std::size_t m = S.rows();
+    for (std::size_t k = 0; k < m; ++k) {
+        double *s = S.row_data(k);
+        const double d = s[0];
+        const double r2 = d * d - x[k] * x[k];
+        if (k + 1 == m) {
+            s[0] = std::sqrt(std::max(r2, 0.0));
+            break;
+        }
+        if (r2 <= kMinDowndateRatio * d * d) {
+            return false;
+        }
+        const double r = std::sqrt(r2);
+        const double c = r / d;
+        const double sn = x[k] / d;
+        s[0] = r;
+        for (std::size_t j = k + 1; j < m; ++j) {
+            s[j - k] = (s[j - k] - sn * x[j]) / c;
+            x[j] = c * x[j] - sn * s[j - k];
+        }
+    }
+    return true;
+}
+} // namespace
+
+RecursiveLeastSquares::RecursiveLeastSquares(std::size_t n,
+                                             double forgetting)
+    : n_(n), lambda_(forgetting), s_(n + 1, Triangle::Upper),
+      work_(n + 1) {
+    if (!(forgetting > 0.0 && forgetting <= 1.0)) {
+        throw std::invalid_argument(
+            "RecursiveLeastSquares: forgetting factor must be in (0, 1]");
+    }
+}
+
+void RecursiveLeastSquares::clear() {
+    s_ = TriangularMatrix(n_ + 1, Triangle::Upper);
+    observations_ = 0;
+}
+
+void RecursiveLeastSquares::add(const Vector &a, double b) {
+    if (a.size() != n_) {
+        throw std::invalid_argument(
+            "RecursiveLeastSquares::add: row size must match the unknowns");
+    }
+    if (lambda_ != 1.0) {
+        const double w = std::sqrt(lambda_);
+        for (std::size_t k = 0; k <= n_; ++k) {
+            double *s = s_.row_data(k);
+            for (std::size_t j = 0; j <= n_ - k; ++j) {
+                s[j] *= w;
+            }
+        }
+    }
+    for (std::size_t j = 0; j < n_; ++j) {
+        work_[j] = a[j];
+    }
+    work_[n_] = b;
+    givens_update(s_, work_);
+    ++observations_;
+}
+
+void RecursiveLeastSquares::remove(const Vector &a, double b) {
+    if (a.size() != n_) {
+        throw std::invalid_argument(
+            "RecursiveLeastSquares::remove: row size must match the "
+            "unknowns");
+    }
+    for (std::size_t j = 0; j < n_; ++j) {
+        work_[j] = a[j];
+    }
+    work_[n_] = b;
+    TriangularMatrix S = s_;
+    if (!hyperbolic_downdate(S, work_)) {
+        throw std::domain_error(
+            "RecursiveLeastSquares::remove: remaining rows are rank "
+            "deficient");
+    }
+    s_ = std::move(S);
+    if (observations_ > 0) {
+        --observations_;
+    }
+}
+
+bool RecursiveLeastSquares::is_full_rank() const noexcept {
+    double scale = 0.0;
+    for (std::size_t k = 0; k < n_; ++k) {
+        scale = std::max(scale, std::fabs(s_.row_data(k)[0]));
+    }
+    for (std::size_t k = 0; k < n_; ++k) {
+        if (math_utils::is_effectively_zero(s_.row_data(k)[0], scale)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Vector RecursiveLeastSquares::solution() const {
+    if (!is_full_rank()) {
+        throw std::domain_error(
+            "RecursiveLeastSquares::solution: too few independent rows");
+    }
+    // R x = z, where z is the last column of the factor.
+    Vector x(n_);
+    for (std::size_t i = n_; i-- > 0;) {
+        const double *s = s_.row_data(i); // s[j - i] = S(i, j)
+        double sum = s[n_ - i];
+        for (std::size_t j = i + 1; j < n_; ++j) {
+            sum -= s[j - i] * x[j];
+        }
+        x[i] = sum / s[0];
+    }
+    return x;
+}
+
+double RecursiveLeastSquares::residual_norm() const noexcept {
+    return std::fabs(s_.row_data(n_)[0]);
+}
+} // namespace la
@@ -0,0 +1,147 @@
+#include "la/reordering.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace la {
+namespace {
+using Graph = std::vector<std::vector<std::size_t>>;
+
+void check_square(const Matrix &A, const char *what) {
+    if (A.rows() != A.cols()) {
+        throw std::invalid_argument(what);
+    }
+}
+
+// Adjacency lists of the nonzero pattern of A + A^T, without self loops.
+Graph adjacency(const Matrix &A) {
+    const std::size_t n = A.rows();
+    Graph g(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i + 1; j < n; ++j) {
+            if (A(i, j) != 0.0 || A(j, i) != 0.0) {
+                g[i].push_back(j);
+                g[j].push_back(i);
+            }
+        }
+    }
+    return g;
+}
+
+// Breadth-first level structure rooted at start, restricted to unvisited
+// nodes.  Returns the nodes of the last level and the number of levels.
+std::size_t last_level(const Graph &g, std::size_t start,
+                       const std::vector<bool> &visited,
+                       std::vector<std::size_t> &last) {
+    std::vector<bool> seen(visited);
+    std::vector<std::size_t> level{start};
+    seen[start] = true;
+    std::size_t depth = 0;
+    while (!level.empty()) {
+        last = level;
+        ++depth;
+        std::vector<std::size_t> next;
+        for (std::size_t u : level) {
+            for (std::size_t v : g[u]) {
+                if (!seen[v]) {
+                    seen[v] = true;
+                    next.push_back(v);
+                }
+            }
+        }
+        level.swap(next);
+    }
+    return depth;
+}
+
+// George-Liu pseudo-peripheral node search: move to a minimum-degree node of
+// the farthest level while that increases the eccentricity.
+std::size_t pseudo_peripheral_node(const Graph &g, std::size_t start,
+                                   const std::vector<bool> &visited) {
+    std::vector<std::size_t> last;
+    std::size_t node = start;
+    std::size_t depth = last_level(g, node, visited, last);
+    for (;;) {
+        std::size_t candidate = last.front();
+        for (std::size_t v : last) {
+            if (g[v].size() < g[candidate].size()) {
+                candidate = v;
+            }
+        }
+        std::vector<std::size_t> candidate_last;
+        const std::size_t candidate_depth =
+            last_level(g, candidate, visited, candidate_last);
+        if (candidate_depth <= depth) {
+            return node;
+        }
+        node = candidate;
+        depth = candidate_depth;
+        last.swap(candidate_last);
+    }
+}
+} // namespace
+
+std::size_t bandwidth(const Matrix &A) {
+    check_square(A, "bandwidth: matrix must be square");
+    std::size_t bw = 0;
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            if (A(i, j) != 0.0) {
+                bw = std::max(bw, i > j ? i - j : j - i);
+            }
+        }
+    }
+    return bw;
+}
+
+Permutation rcm_permutation(const Matrix &A) {
+    check_square(A, "rcm_permutation: matrix must be square");
+    const std::size_t n = A.rows();
+    const Graph g = adjacency(A);
+
+    std::vector<bool> visited(n, false);
+    std::vector<std::size_t> order;
+    order.reserve(n);
+
+    // Components are started in order of their minimum-degree node so the
+    // result is deterministic.
+    std::vector<std::size_t> by_degree(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        by_degree[i] = i;
+    }
+    std::stable_sort(by_degree.begin(), by_degree.end(),
+                     [&g](std::size_t a, std::size_t b) {
+                         return g[a].size() < g[b].size();
+                     });
+
+    for (std::size_t seed : by_degree) {
+        if (visited[seed])
+            continue;
+
+        const std::size_t root = pseudo_peripheral_node(g, seed, visited);
+        std::size_t head = order.size();
+        order.push_back(root);
+        visited[root] = true;
+
+        // Cuthill-McKee: order appended neighbours by increasing degree.
+        while (head < order.size()) {
+            const std::size_t u = order[head++];
+            const std::size_t first_new = order.size();
+            for (std::size_t v : g[u]) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    order.push_back(v);
+                }
+            }
+            std::stable_sort(order.begin() + first_new, order.end(),
+                             [&g](std::size_t a, std::size_t b) {
+                                 return g[a].size() < g[b].size();
+                             });
+        }
+    }
+
+    std::reverse(order.begin(), order.end());
+    return Permutation(std::move(order));
+}
+} // namespace la
@@ -11,22 +11,20 @@ struct Pivot {
     double value;
 };
 
-Pivot find_leftmost_pivot(const Matrix &A, std::size_t start_row);
 void normalize_row(Matrix &A, std::size_t row, double pivot_value);
-void eliminate_below(Matrix &A, std::size_t lead_row, std::size_t lead_col);
-void eliminate_above(Matrix &A, std::size_t lead_row, std::size_t lead_col);
-void row_replace(Matrix &A, std::size_t i, std::size_t lead_col,
-                 std::size_t lead_row);
+double row_replace(Matrix &A, std::size_t i, std::size_t lead_col,
+                   std::size_t lead_row);
 
-void row_replace(Matrix &A, std::size_t row, std::size_t lead_col,
-                 std::size_t lead_row) {
+// Returns the multiple of the lead row that was subtracted (0 if none).
+double row_replace(Matrix &A, std::size_t row, std::size_t lead_col,
+                   std::size_t lead_row) {
     const double piv = A(lead_row, lead_col);
     if (is_zero_pivot(piv))
         throw std::invalid_argument("row_replace: zero pivot encountered");
 
     const double a = A(row, lead_col);
     if (is_zero_pivot(a))
-        return;
+        return 0.0;
 
     const double factor = a / piv;
 
@@ -35,6 +33,7 @@ void row_replace(Matrix &A, std::size_t row, std::size_t lead_col,
     }
 
     A(row, lead_col) = 0.0;
+    return factor;
 }
 
 void normalize_row(Matrix &A, std::size_t row, double pivot_value) {
@@ -44,19 +43,66 @@ void normalize_row(Matrix &A, std::size_t row, double pivot_value) {
         A(row, j) /= pivot_value;
 }
 
-void eliminate_below(Matrix &A, std::size_t lead_row, std::size_t lead_col) {
+namespace {
+// The elimination below is written against logical rows.  A row map turns
+// a logical row index into a physical row of the matrix and carries out
+// row interchanges.  Optional right-hand sides (rhs) receive every row
+// operation applied to the matrix, as if they were extra columns.
+
+// Logical row i is physical row i; an interchange moves the row contents.
+struct PhysicalRows {
+    Matrix &A;
+    Matrix *rhs;
+    std::size_t operator[](std::size_t i) const noexcept { return i; }
+    void swap(std::size_t a, std::size_t b) {
+        A.exchange_rows(a, b);
+        if (rhs)
+            rhs->exchange_rows(a, b);
+    }
+};
+
+// Logical row i is physical row rows[i]; an interchange is only recorded.
+struct PermutedRows {
+    Permutation &rows;
+    Matrix *rhs;
+    std::size_t operator[](std::size_t i) const noexcept { return rows[i]; }
+    void swap(std::size_t a, std::size_t b) { rows.swap(a, b); }
+};
+
+// row -= factor * lead_row on the right-hand sides.
+void rhs_replace(Matrix *rhs, std::size_t row, std::size_t lead_row,
+                 double factor) {
+    if (!rhs || factor == 0.0)
+        return;
+    for (std::size_t col = 0; col < rhs->cols(); ++col) {
+        (*rhs)(row, col) -= factor * (*rhs)(lead_row, col);
+    }
+}
+
+template <typename Rows>
+void eliminate_below(Matrix &A, const Rows &rows, std::size_t lead_row,
+                     std::size_t lead_col) {
     for (std::size_t i = lead_row + 1; i < A.rows(); ++i) {
-        row_replace(A, i, lead_col, lead_row);
+        const double factor =
+            row_replace(A, rows[i], lead_col, rows[lead_row]);
+        rhs_replace(rows.rhs, rows[i], rows[lead_row], factor);
     }
 }
 
-void eliminate_above(Matrix &A, std::size_t lead_row, std::size_t lead_col) {
+template <typename Rows>
+void eliminate_above(Matrix &A, const Rows &rows, std::size_t lead_row,
+                     std::size_t lead_col) {
     for (std::size_t i = 0; i < lead_row; ++i) {
-        row_replace(A, i, lead_col, lead_row);
+        const double factor =
+            row_replace(A, rows[i], lead_col, rows[lead_row]);
+        rhs_replace(rows.rhs, rows[i], rows[lead_row], factor);
     }
 }
 
-Pivot find_leftmost_pivot(const Matrix &A, std::size_t start_row) {
+// Returns the logical row of the pivot.
+template <typename Rows>
+Pivot find_leftmost_pivot(const Matrix &A, const Rows &rows,
+                          std::size_t start_row) {
     const std::size_t m = A.rows();
     const std::size_t n = A.cols();
 
@@ -64,7 +110,8 @@ Pivot find_leftmost_pivot(const Matrix &A, std::size_t start_row) {
     double submatrix_scale = 0.0;
     for (std::size_t i = start_row; i < m; ++i) {
         for (std::size_t j = 0; j < n; ++j) {
-            submatrix_scale = std::max(submatrix_scale, std::fabs(A(i, j)));
+            submatrix_scale =
+                std::max(submatrix_scale, std::fabs(A(rows[i], j)));
         }
     }
 
@@ -73,7 +120,7 @@ Pivot find_leftmost_pivot(const Matrix &A, std::size_t start_row) {
         double best_abs = 0.0;
 
         for (std::size_t i = start_row; i < m; ++i) {
-            const double v = std::fabs(A(i, j));
+            const double v = std::fabs(A(rows[i], j));
             if (v > best_abs) {
                 best_abs = v;
                 best_row = i;
@@ -84,12 +131,13 @@ Pivot find_leftmost_pivot(const Matrix &A, std::size_t start_row) {
             continue;
 
         if (!math_utils::is_effectively_zero(best_abs, submatrix_scale)) {
-            return {best_row, j, A(best_row, j)};
+            return {best_row, j, A(rows[best_row], j)};
         }
     }
 
     return {m, n, 0.0};
 }
+} // namespace
 
 bool is_ref(const Matrix &A) {
     /*
@@ -168,8 +216,25 @@ bool is_rref(const Matrix &A) {
     return true;
 }
 
-Matrix ref(const Matrix &A) {
-    Matrix R = A; // copy of matrix A
+namespace {
+// Complete info.pivot_cols (ascending) with the columns that have no pivot.
+void fill_free_cols(PivotInfo &info, std::size_t n) {
+    info.free_cols.reserve(n - info.pivot_cols.size());
+    std::size_t next_pivot = 0;
+    for (std::size_t col = 0; col < n; ++col) {
+        if (next_pivot < info.pivot_cols.size() &&
+            info.pivot_cols[next_pivot] == col) {
+            ++next_pivot;
+        } else {
+            info.free_cols.push_back(col);
+        }
+    }
+}
+
+template <typename Rows>
+void reduce_to_ref(Matrix &R, Rows rows, PivotInfo &info) {
+    info.pivot_cols.clear();
+    info.free_cols.clear();
 
     // Guidelines from Poole, Linear Algebra: A Modern Introduction, 2nd ed, pp
     // 72-73
@@ -179,45 +244,104 @@ Matrix ref(const Matrix &A) {
     for (std::size_t lead_row = 0; lead_row < m; ++lead_row) {
         // 1. Locate the leftmost non-zero column of the rows below (and
         // including) the top row
-        Pivot p = find_leftmost_pivot(R, lead_row);
+        Pivot p = find_leftmost_pivot(R, rows, lead_row);
         if (p.col == n)
             break; // non nonzero columns below => done
 
         // 2. Create a leading entry in the top row by interchanging it with
         // the top row
         if (p.row != lead_row)
-            R.exchange_rows(lead_row, p.row);
+            rows.swap(lead_row, p.row);
 
         // 3. Use the pivot to create zeros below it on the
         // lead_col.
-        eliminate_below(R, lead_row, p.col);
+        eliminate_below(R, rows, lead_row, p.col);
+        info.pivot_cols.push_back(p.col);
     }
 
-    return R;
+    fill_free_cols(info, n);
 }
 
-Matrix rref(const Matrix &A) {
-    Matrix R = ref(A); // REF: zeros below pivots, zero rows at bottom
+template <typename Rows>
+void reduce_to_rref(Matrix &R, Rows rows, PivotInfo &info) {
+    reduce_to_ref(R, rows, info); // zeros below pivots, zero rows at bottom
 
     // Guidelines from Poole, Linear Algebra: A Modern Introduction, 2nd ed, p.
     // 76 Starting from row 2, for each row until first zero row:
-    //   - find leftmost pivot column
+    //   - take the pivot found by the REF pass
     //   - create leading one
     //   - create zeros above it by eliminate_above()
-    const std::size_t m = R.rows(), n = R.cols();
-    for (std::size_t lead_row = 0; lead_row < m; ++lead_row) {
-        Pivot p = find_leftmost_pivot(R, lead_row);
-        if (p.col == n)
-            break; // first zero row => done
+    for (std::size_t lead_row = 0; lead_row < info.pivot_cols.size();
+         ++lead_row) {
+        const std::size_t col = info.pivot_cols[lead_row];
 
         // Normalise the row by pivot value to have leading one
-        double pivot_value = R(lead_row, p.col);
-        normalize_row(R, lead_row, pivot_value);
+        double pivot_value = R(rows[lead_row], col);
+        normalize_row(R, rows[lead_row], pivot_value);
+        if (rows.rhs)
+            normalize_row(*rows.rhs, rows[lead_row], pivot_value);
 
         // Use the leading 1 to create zeros above it on the lead column
-        eliminate_above(R, lead_row, p.col);
+        eliminate_above(R, rows, lead_row, col);
+    }
+}
+} // namespace
+
+PivotInfo ref_inplace(Matrix &R) {
+    PivotInfo info;
+    ref_inplace(R, info);
+    return info;
+}
+
+void ref_inplace(Matrix &R, PivotInfo &info) {
+    reduce_to_ref(R, PhysicalRows{R, nullptr}, info);
+}
+
+void ref_inplace(Matrix &R, Matrix &B, PivotInfo &info) {
+    if (B.rows() != R.rows()) {
+        throw std::invalid_argument(
+            "ref_inplace: right-hand sides must have as many rows as A");
+    }
+    reduce_to_ref(R, PhysicalRows{R, &B}, info);
+}
+
+void ref_inplace(Matrix &R, PivotInfo &info, Permutation &rows) {
+    rows = Permutation(R.rows());
+    reduce_to_ref(R, PermutedRows{rows, nullptr}, info);
+}
+
+PivotInfo rref_inplace(Matrix &R) {
+    PivotInfo info;
+    reduce_to_rref(R, PhysicalRows{R, nullptr}, info);
+    return info;
+}
+
+PivotInfo rref_inplace(Matrix &R, Matrix &B) {
+    if (B.rows() != R.rows()) {
+        throw std::invalid_argument(
+            "rref_inplace: right-hand sides must have as many rows as A");
     }
+    PivotInfo info;
+    reduce_to_rref(R, PhysicalRows{R, &B}, info);
+    return info;
+}
 
+PivotInfo rref_inplace(Matrix &R, Permutation &rows) {
+    rows = Permutation(R.rows());
+    PivotInfo info;
+    reduce_to_rref(R, PermutedRows{rows, nullptr}, info);
+    return info;
+}
+
+Matrix ref(const Matrix &A) {
+    Matrix R = A; // copy of matrix A
+    ref_inplace(R);
+    return R;
+}
+
+Matrix rref(const Matrix &A) {
+    Matrix R = A; // copy of matrix A
+    rref_inplace(R);
     return R;
 }
 
@@ -226,11 +350,22 @@ std::size_t rank(const Matrix &A) {
     return rank_from_ref(refm);
 }
 
+std::size_t rank(const Matrix &A, Workspace &ws) {
+    ws.reset();
+    Matrix &R = ws.copy(A);
+    ref_inplace(R, ws.pivots());
+    return rank_from_ref(R);
+}
+
 std::size_t rank_from_ref(const Matrix &R) {
+    // Same test as is_zero(R.row(i)), without copying each row out.
     std::size_t r = 0;
     for (std::size_t i = 0; i < R.rows(); ++i) {
-        if (!is_zero(R.row(i))) {
-            ++r;
+        for (std::size_t j = 0; j < R.cols(); ++j) {
+            if (!is_zero_pivot(R(i, j))) {
+                ++r;
+                break;
+            }
         }
     }
     return r;
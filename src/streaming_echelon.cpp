@@ -0,0 +1,131 @@
+#include "la/streaming_echelon.hpp"
+#include "math_utils/math_utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace la {
+StreamingEchelon::StreamingEchelon(std::size_t n)
+    : n_(n), stride_(n + 1), work_(n + 1) {
+    clear();
+}
+
+void StreamingEchelon::clear() {
+    rows_seen_ = 0;
+    consistent_ = true;
+    pivots_.pivot_cols.clear();
+    pivots_.free_cols.clear();
+    for (std::size_t j = 0; j < n_; ++j) {
+        pivots_.free_cols.push_back(j);
+    }
+    order_.clear();
+    rows_.clear();
+}
+
+bool StreamingEchelon::add_row(const Vector &a, double b) {
+    if (a.size() != n_) {
+        throw std::invalid_argument(
+            "StreamingEchelon::add_row: row size must match the variables");
+    }
+    ++rows_seen_;
+
+    double *x = work_.data();
+    double scale = 0.0;
+    for (std::size_t j = 0; j < n_; ++j) {
+        x[j] = a[j];
+        scale = std::max(scale, std::fabs(a[j]));
+    }
+    x[n_] = b;
+
+    // Every pivot column is a unit column of the RREF, so the rows can be
+    // subtracted in any order.
+    const std::size_t r = rank();
+    for (std::size_t i = 0; i < r; ++i) {
+        const double factor = x[pivots_.pivot_cols[i]];
+        if (factor == 0.0)
+            continue;
+        const double *p = row(i);
+        for (std::size_t j = 0; j <= n_; ++j) {
+            x[j] -= factor * p[j];
+        }
+    }
+
+    std::size_t col = 0;
+    while (col < n_ && math_utils::is_effectively_zero(x[col], scale)) {
+        ++col;
+    }
+    if (col == n_) {
+        // 0 = x[n_]: redundant, or a contradiction.
+        const double rhs_scale = std::max(scale, std::fabs(b));
+        if (!math_utils::is_effectively_zero(x[n_], rhs_scale)) {
+            consistent_ = false;
+        }
+        return false;
+    }
+
+    // New pivot row with a leading 1; round-off left of it is dropped.
+    const double piv = x[col];
+    for (std::size_t j = 0; j < col; ++j) {
+        x[j] = 0.0;
+    }
+    for (std::size_t j = col; j <= n_; ++j) {
+        x[j] /= piv;
+    }
+    x[col] = 1.0;
+
+    // Clear the new pivot column from the rows already there.  Rows whose
+    // pivot lies right of col are zero in it already.
+    for (std::size_t i = 0; i < r; ++i) {
+        double *p = row(i);
+        const double factor = p[col];
+        if (factor == 0.0)
+            continue;
+        for (std::size_t j = col; j <= n_; ++j) {
+            p[j] -= factor * x[j];
+        }
+        p[col] = 0.0;
+    }
+
+    rows_.insert(rows_.end(), work_.begin(), work_.end());
+    const auto at = std::lower_bound(pivots_.pivot_cols.begin(),
+                                     pivots_.pivot_cols.end(), col);
+    order_.insert(order_.begin() + (at - pivots_.pivot_cols.begin()), r);
+    pivots_.pivot_cols.insert(at, col);
+    pivots_.free_cols.erase(std::lower_bound(pivots_.free_cols.begin(),
+                                             pivots_.free_cols.end(), col));
+    return true;
+}
+
+Matrix StreamingEchelon::reduced() const {
+    Matrix R(rank(), stride_);
+    for (std::size_t i = 0; i < rank(); ++i) {
+        const double *p = row(i);
+        for (std::size_t j = 0; j < stride_; ++j) {
+            R(i, j) = p[j];
+        }
+    }
+    return R;
+}
+
+LinearSystemSolution StreamingEchelon::solution() const {
+    // Split the stored rows into A and b for solution_from_ref().  A
+    // contradiction is recorded as one extra row 0 = 1 below them.
+    const std::size_t m = rank() + (consistent_ ? 0 : 1);
+    Matrix R(m, n_);
+    Matrix B(m, std::size_t{1});
+    for (std::size_t i = 0; i < rank(); ++i) {
+        const double *p = row(i);
+        for (std::size_t j = 0; j < n_; ++j) {
+            R(i, j) = p[j];
+        }
+        B(i, 0) = p[n_];
+    }
+    if (!consistent_) {
+        B(m - 1, 0) = 1.0;
+    }
+
+    LinearSystemSolution sol;
+    solution_from_ref(R, B, 0, pivots_, sol);
+    return sol;
+}
+} // namespace la
@@ -0,0 +1,71 @@
+#include "la/symmetric_matrix.hpp"
+#include <stdexcept>
+
+namespace la {
+SymmetricMatrix::SymmetricMatrix(const Matrix &A) : SymmetricMatrix() {
+    if (A.rows() != A.cols()) {
+        throw std::invalid_argument("SymmetricMatrix: matrix must be square");
+    }
+    n_ = A.rows();
+    data_.assign(n_ * (n_ + 1) / 2, 0.0);
+    for (std::size_t i = 0; i < n_; ++i) {
+        for (std::size_t j = i; j < n_; ++j) {
+            data_[index(i, j)] = A(i, j);
+        }
+    }
+}
+
+double &SymmetricMatrix::at(std::size_t i, std::size_t j) {
+    if (i >= n_ || j >= n_) {
+        throw std::out_of_range("SymmetricMatrix: index out of range");
+    }
+    return data_[index(i, j)];
+}
+
+Matrix to_matrix(const SymmetricMatrix &S) {
+    Matrix A(S.rows(), S.cols());
+    for (std::size_t i = 0; i < S.rows(); ++i) {
+        for (std::size_t j = i; j < S.cols(); ++j) {
+            A(i, j) = S(i, j);
+            A(j, i) = S(i, j);
+        }
+    }
+    return A;
+}
+
+Vector symv(const SymmetricMatrix &S, const Vector &x) {
+    const std::size_t n = S.rows();
+    if (x.size() != n) {
+        throw std::invalid_argument("symv: vector size must match matrix");
+    }
+    // Each stored upper element contributes to both y[i] and y[j].
+    Vector y(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        double sum = S(i, i) * x[i];
+        const double xi = x[i];
+        for (std::size_t j = i + 1; j < n; ++j) {
+            const double s = S(i, j);
+            sum += s * x[j];
+            y[j] += s * xi;
+        }
+        y[i] += sum;
+    }
+    return y;
+}
+
+SymmetricMatrix syrk(const Matrix &A) {
+    const std::size_t m = A.rows();
+    const std::size_t k = A.cols();
+    SymmetricMatrix C(m);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = i; j < m; ++j) {
+            double sum = 0.0;
+            for (std::size_t p = 0; p < k; ++p) {
+                sum += A(i, p) * A(j, p);
+            }
+            C(i, j) = sum;
+        }
+    }
+    return C;
+}
+} // namespace la
@@ -0,0 +1,137 @@
+#include "la/triangular_matrix.hpp"
+#include "la/pivot_policy.hpp"
+#include <stdexcept>
+
+namespace la {
+namespace {
+double checked_diagonal(const TriangularMatrix &T, std::size_t i) {
+    const double d = T(i, i);
+    if (is_zero_pivot(d)) {
+        throw std::domain_error("triangular solve: zero on the diagonal");
+    }
+    return d;
+}
+} // namespace
+
+TriangularMatrix::TriangularMatrix(const Matrix &A, Triangle uplo)
+    : TriangularMatrix() {
+    if (A.rows() != A.cols()) {
+        throw std::invalid_argument("TriangularMatrix: matrix must be square");
+    }
+    *this = leading_triangle(A, A.rows(), uplo);
+}
+
+double &TriangularMatrix::at(std::size_t i, std::size_t j) {
+    if (i >= n_ || j >= n_) {
+        throw std::out_of_range("TriangularMatrix: index out of range");
+    }
+    if (!in_triangle(i, j)) {
+        throw std::out_of_range(
+            "TriangularMatrix: index outside the stored triangle");
+    }
+    return data_[index(i, j)];
+}
+
+TriangularMatrix leading_triangle(const Matrix &A, std::size_t n,
+                                  Triangle uplo) {
+    if (n > A.rows() || n > A.cols()) {
+        throw std::out_of_range(
+            "leading_triangle: n exceeds the matrix dimensions");
+    }
+    TriangularMatrix T(n, uplo);
+    for (std::size_t i = 0; i < n; ++i) {
+        double *row = T.row_data(i);
+        for (std::size_t j = T.first_col(i); j < T.last_col(i); ++j) {
+            *row++ = A(i, j);
+        }
+    }
+    return T;
+}
+
+Matrix to_matrix(const TriangularMatrix &T) {
+    Matrix A(T.rows(), T.cols());
+    for (std::size_t i = 0; i < T.rows(); ++i) {
+        for (std::size_t j = 0; j < T.cols(); ++j) {
+            A(i, j) = T(i, j);
+        }
+    }
+    return A;
+}
+
+Vector trmv(const TriangularMatrix &T, const Vector &x) {
+    const std::size_t n = T.rows();
+    if (x.size() != n) {
+        throw std::invalid_argument("trmv: vector size must match matrix");
+    }
+    Vector y(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double *row = T.row_data(i);
+        double sum = 0.0;
+        for (std::size_t j = T.first_col(i); j < T.last_col(i); ++j) {
+            sum += *row++ * x[j];
+        }
+        y[i] = sum;
+    }
+    return y;
+}
+
+Vector trsv(const TriangularMatrix &T, const Vector &b) {
+    const std::size_t n = T.rows();
+    if (b.size() != n) {
+        throw std::invalid_argument("trsv: vector size must match matrix");
+    }
+    Vector x(n);
+    if (T.triangle() == Triangle::Upper) {
+        // Back substitution, bottom row first.
+        for (std::size_t i = n; i-- > 0;) {
+            double sum = 0.0;
+            for (std::size_t j = i + 1; j < n; ++j) {
+                sum += T(i, j) * x[j];
+            }
+            x[i] = (b[i] - sum) / checked_diagonal(T, i);
+        }
+    } else {
+        // Forward substitution, top row first.
+        for (std::size_t i = 0; i < n; ++i) {
+            double sum = 0.0;
+            for (std::size_t j = 0; j < i; ++j) {
+                sum += T(i, j) * x[j];
+            }
+            x[i] = (b[i] - sum) / checked_diagonal(T, i);
+        }
+    }
+    return x;
+}
+
+Matrix trsm(const TriangularMatrix &T, const Matrix &B) {
+    const std::size_t n = T.rows();
+    const std::size_t k = B.cols();
+    if (B.rows() != n) {
+        throw std::invalid_argument("trsm: row count must match matrix");
+    }
+
+    // Row-oriented substitution: each solved row of X is subtracted from the
+    // remaining rows as a whole, so the inner loops run along contiguous
+    // rows of X and B instead of one right-hand side at a time.
+    Matrix X = B;
+    const bool upper = T.triangle() == Triangle::Upper;
+    for (std::size_t step = 0; step < n; ++step) {
+        const std::size_t i = upper ? n - 1 - step : step;
+        const double d = checked_diagonal(T, i);
+        for (std::size_t c = 0; c < k; ++c) {
+            X(i, c) /= d;
+        }
+        const std::size_t first = upper ? 0 : i + 1;
+        const std::size_t last = upper ? i : n;
+        for (std::size_t r = first; r < last; ++r) {
+            const double t = T(r, i);
+            if (t == 0.0)
+                continue;
+            for (std::size_t c = 0; c < k; ++c) {
+                X(r, c) -= t * X(i, c);
+            }
+        }
+    }
+    return X;
+}
+} // namespace la
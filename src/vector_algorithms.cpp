@@ -99,8 +99,11 @@ double leading_element(const Vector &v) {
     }
 }
 
-bool are_linearly_independent(const std::vector<Vector> vectors) {
-    const Matrix A = from_cols(vectors);
-    return rank(A) == vectors.size();
+bool are_linearly_independent(const std::vector<Vector> &vectors) {
+    // A is already a private copy, so reduce it in place instead of letting
+    // rank() copy it again.
+    Matrix A = from_cols(vectors);
+    ref_inplace(A);
+    return rank_from_ref(A) == vectors.size();
 }
 } // namespace la
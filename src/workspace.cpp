@@ -0,0 +1,44 @@
+#include "la/workspace.hpp"
+
+namespace la {
+template <typename T>
+T &Workspace::next(std::vector<std::unique_ptr<T>> &pool, std::size_t &used) {
+    // Pool entries are heap-allocated once so references handed out earlier
+    // stay valid when the pool grows.
+    if (used == pool.size()) {
+        pool.push_back(std::unique_ptr<T>(new T()));
+    }
+    return *pool[used++];
+}
+
+Matrix &Workspace::matrix(std::size_t rows, std::size_t cols) {
+    Matrix &M = next(matrices_, matrices_used_);
+    M.assign(rows, cols);
+    return M;
+}
+
+Matrix &Workspace::copy(const Matrix &A) {
+    Matrix &M = next(matrices_, matrices_used_);
+    M = A; // copy-assignment reuses M's buffer when it is large enough
+    return M;
+}
+
+Vector &Workspace::vector(std::size_t n) {
+    Vector &v = next(vectors_, vectors_used_);
+    v.assign(n);
+    return v;
+}
+
+std::vector<std::size_t> &Workspace::indices() {
+    std::vector<std::size_t> &idx = next(indices_, indices_used_);
+    idx.clear();
+    return idx;
+}
+
+PivotInfo &Workspace::pivots() {
+    PivotInfo &info = next(pivots_, pivots_used_);
+    info.pivot_cols.clear();
+    info.free_cols.clear();
+    return info;
+}
+} // namespace la
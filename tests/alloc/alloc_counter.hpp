@@ -0,0 +1,19 @@
+#ifndef ALLOC_COUNTER_HPP
+#define ALLOC_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace alloc_counter {
+// Calls of the global operator new so far, counted in main.cpp.
+extern std::atomic<std::size_t> count;
+
+// Number of heap allocations made while running f().
+template <typename F> std::size_t allocations_in(F f) {
+    const std::size_t before = count.load();
+    f();
+    return count.load() - before;
+}
+} // namespace alloc_counter
+
+#endif // ALLOC_COUNTER_HPP
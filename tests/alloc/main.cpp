@@ -0,0 +1,32 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest.h"
+#include "alloc_counter.hpp"
+#include <cstdlib>
+#include <new>
+
+// Every heap allocation in this program goes through these replacements, so
+// alloc_counter sees std::vector and std::string growth as well as Matrix and
+// Vector buffers.  They live in their own binary (`make alloc_tests`) so the
+// main test suite keeps the default allocator.
+
+namespace alloc_counter {
+std::atomic<std::size_t> count{0};
+} // namespace alloc_counter
+
+void *operator new(std::size_t size) {
+    alloc_counter::count.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete[](void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
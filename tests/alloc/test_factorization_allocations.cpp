@@ -0,0 +1,77 @@
+#include "doctest/doctest.h"
+#include "la/cholesky.hpp"
+#include "la/lu.hpp"
+#include "la/matrix.hpp"
+#include "la/vector.hpp"
+#include "la/workspace.hpp"
+#include "../test_utils.hpp"
+#include "alloc_counter.hpp"
+
+using alloc_counter::allocations_in;
+
+namespace {
+// Diagonally dominant and symmetric, so positive definite.
+la::Matrix spd_matrix(std::size_t n) {
+    la::Matrix A(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            A(i, j) = static_cast<double>((i + j) % 5) - 2.0;
+        }
+        A(i, i) += 4.0 * static_cast<double>(n);
+    }
+    return A;
+}
+
+la::Matrix columns(std::size_t n, std::size_t k, std::size_t seed) {
+    la::Matrix X(n, k);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t t = 0; t < k; ++t) {
+            X(i, t) = static_cast<double>((i * seed + t + 1) % 5) - 2.0;
+        }
+    }
+    return X;
+}
+} // namespace
+
+TEST_CASE("factorization workspace calls make no allocations in steady "
+          "state") {
+    const std::size_t n = 16;
+    const la::Matrix A = spd_matrix(n);
+    const la::Vector b = columns(n, 1, 3).column(0);
+    la::Workspace ws;
+
+    SUBCASE("LU solves with corrections") {
+        la::LU lu(A);
+        lu.update(columns(n, 2, 1), columns(n, 2, 2));
+        REQUIRE_EQ(lu.correction_rank(), 2);
+
+        la::Vector x;
+        lu.solve(b, x, ws);
+        CHECK_EQ(allocations_in([&] { lu.solve(b, x, ws); }), 0);
+        CHECK_NEAR(lu.matrix() * x, b);
+
+        const la::Matrix B = columns(n, 3, 4);
+        la::Matrix X;
+        lu.solve(B, X, ws);
+        CHECK_EQ(allocations_in([&] { lu.solve(B, X, ws); }), 0);
+        CHECK(la::approx_equal(lu.matrix() * X, B, 1e-10, 1e-9));
+    }
+
+    SUBCASE("Cholesky solves, updates and downdates") {
+        la::Cholesky ch(A);
+        la::Vector x;
+        ch.solve(b, x, ws);
+        CHECK_EQ(allocations_in([&] { ch.solve(b, x, ws); }), 0);
+        CHECK_NEAR(A * x, b);
+
+        const la::Matrix X = columns(n, 2, 5);
+        ch.update(X, ws);
+        ch.downdate(X, ws);
+        CHECK_EQ(allocations_in([&] {
+                     ch.update(X, ws);
+                     ch.downdate(X, ws);
+                 }),
+                 0);
+        CHECK(la::approx_equal(to_matrix(ch.matrix()), A, 1e-10, 1e-9));
+    }
+}
@@ -0,0 +1,103 @@
+#include "doctest/doctest.h"
+#include "la/determinant.hpp"
+#include "la/linear_system.hpp"
+#include "la/matrix.hpp"
+#include "la/matrix_transforms.hpp"
+#include "la/row_reduction.hpp"
+#include "la/workspace.hpp"
+#include "../test_utils.hpp"
+#include "alloc_counter.hpp"
+
+using alloc_counter::allocations_in;
+
+namespace {
+la::Matrix sample_system() {
+    // clang-format off
+    return la::Matrix(4, 4, {
+                                 2, 1, 0, 3,
+                                 1, 3, 1, 0,
+                                 0, 1, 4, 1,
+                                 3, 0, 1, 5
+                             });
+    // clang-format on
+}
+} // namespace
+
+TEST_CASE("Matrix::assign and Vector::assign reuse their buffers") {
+    la::Matrix A(4, 5, 1.0);
+    CHECK_EQ(allocations_in([&] { A.assign(2, 3, 7.0); }), 0);
+    CHECK_EQ(A, la::Matrix(2, 3, 7.0));
+    CHECK_EQ(allocations_in([&] { A.assign(5, 4); }), 0);
+    CHECK_EQ(A, la::Matrix(5, 4));
+
+    la::Vector v{1, 2, 3, 4, 5, 6};
+    CHECK_EQ(allocations_in([&] { v.assign(3); }), 0);
+    CHECK_EQ(v, la::Vector(3));
+}
+
+TEST_CASE("workspace calls make no allocations in steady state") {
+    const la::Matrix A = sample_system();
+    const la::Vector b{1, 2, 3, 4};
+    la::Workspace ws;
+
+    SUBCASE("the counter sees ordinary allocations") {
+        CHECK_GT(allocations_in([] { la::Matrix M(3, 3); }), 0);
+    }
+
+    SUBCASE("rank") {
+        CHECK_EQ(la::rank(A, ws), 4);
+        std::size_t r = 0;
+        CHECK_EQ(allocations_in([&] { r = la::rank(A, ws); }), 0);
+        CHECK_EQ(r, la::rank(A));
+    }
+
+    SUBCASE("determinant") {
+        determinant(A, ws);
+        double d = 0.0;
+        CHECK_EQ(allocations_in([&] { d = determinant(A, ws); }), 0);
+        CHECK_EQ(d, doctest::Approx(-20));
+    }
+
+    SUBCASE("inverse") {
+        la::Matrix out(4, 4);
+        REQUIRE(la::inverse(A, out, ws));
+        bool ok = false;
+        CHECK_EQ(allocations_in([&] { ok = la::inverse(A, out, ws); }), 0);
+        CHECK(ok);
+        CHECK_NEAR(A * out, la::identity(4));
+    }
+
+    SUBCASE("solve") {
+        la::LinearSystemSolution sol;
+        la::solve(A, b, sol, ws);
+        CHECK_EQ(allocations_in([&] { la::solve(A, b, sol, ws); }), 0);
+        REQUIRE(sol.kind == la::SolutionKind::Unique);
+        CHECK_NEAR(A * sol.particular, b);
+    }
+
+    SUBCASE("solve alternating unique and infinite systems") {
+        // The last row of S is the sum of the first two, so x4 is free.
+        // clang-format off
+        const la::Matrix S(4, 4, {
+            2, 1, 0, 3,
+            1, 3, 1, 0,
+            0, 1, 4, 1,
+            3, 4, 1, 3
+        });
+        // clang-format on
+        const la::Vector c{1, 2, 3, 3};
+        la::LinearSystemSolution sol;
+        la::solve(S, c, sol, ws);
+        la::solve(A, b, sol, ws);
+
+        CHECK_EQ(allocations_in([&] {
+                     la::solve(A, b, sol, ws);
+                     la::solve(S, c, sol, ws);
+                 }),
+                 0);
+        REQUIRE(sol.is_infinite());
+        CHECK_EQ(sol.null_space.cols(), 1);
+        CHECK_NEAR(S * sol.particular, c);
+        CHECK_NEAR(S * sol.null_space, la::Matrix(4, 1));
+    }
+}
@@ -0,0 +1,75 @@
+#include "doctest/doctest.h"
+#include "la/big_int.hpp"
+#include <climits>
+#include <stdexcept>
+#include <string>
+
+TEST_CASE("BigInt construction and printing") {
+    using la::BigInt;
+
+    CHECK_EQ(BigInt().to_string(), "0");
+    CHECK_EQ(BigInt(-42).to_string(), "-42");
+    CHECK_EQ(BigInt(LLONG_MIN).to_string(), "-9223372036854775808");
+    CHECK_EQ(BigInt(LLONG_MIN).to_int64(), LLONG_MIN);
+
+    const std::string big = "-123456789012345678901234567890123456789";
+    CHECK_EQ(BigInt(big).to_string(), big);
+    CHECK_EQ(BigInt("+1000000000000000000000").to_string(),
+             "1000000000000000000000");
+    CHECK_EQ(BigInt("-0"), BigInt(0));
+    CHECK_THROWS_AS(BigInt("12a"), std::invalid_argument);
+    CHECK_THROWS_AS(BigInt("-"), std::invalid_argument);
+
+    CHECK(BigInt(LLONG_MAX).fits_int64());
+    CHECK_FALSE((BigInt(LLONG_MAX) + 1).fits_int64());
+    CHECK_THROWS_AS((BigInt(LLONG_MAX) + 1).to_int64(), std::out_of_range);
+    CHECK_EQ(BigInt(1LL << 40).bit_length(), 41);
+    CHECK_EQ(BigInt(-1000000000000000LL).to_double(), -1e15);
+}
+
+TEST_CASE("BigInt arithmetic") {
+    using la::BigInt;
+
+    const BigInt a("123456789012345678901234567890");
+    const BigInt b("-987654321098765432109876543210");
+
+    SUBCASE("addition and subtraction with mixed signs") {
+        CHECK_EQ((a + b).to_string(), "-864197532086419753208641975320");
+        CHECK_EQ((a - b).to_string(), "1111111110111111111011111111100");
+        CHECK_EQ(a - a, BigInt(0));
+        CHECK_EQ((a - a).sign(), 0);
+    }
+
+    SUBCASE("multiplication") {
+        CHECK_EQ((a * b).to_string(), "-12193263113702179522618503273362"
+                                      "2923332237463801111263526900");
+        CHECK_EQ(a * BigInt(0), BigInt(0));
+    }
+
+    SUBCASE("division truncates toward zero") {
+        CHECK_EQ(BigInt(-7) / BigInt(2), BigInt(-3));
+        CHECK_EQ(BigInt(-7) % BigInt(2), BigInt(-1));
+        CHECK_EQ(BigInt(7) % BigInt(-2), BigInt(1));
+        CHECK_THROWS_AS(a / BigInt(0), std::domain_error);
+    }
+
+    SUBCASE("long division round trip") {
+        const BigInt d("98765432109876543211");
+        BigInt q, r;
+        BigInt::divmod(a * b + BigInt(12345), d, q, r);
+        CHECK_EQ(q * d + r, a * b + BigInt(12345));
+        CHECK(la::abs(r) < la::abs(d));
+        CHECK_EQ((a * b) / b, a);
+        CHECK_EQ((a * b) % a, BigInt(0));
+    }
+
+    SUBCASE("comparison, residues and gcd") {
+        CHECK(b < a);
+        CHECK(BigInt(-5) < BigInt(-4));
+        CHECK(a >= a);
+        CHECK_EQ(BigInt(-7).mod(5), 3u);
+        CHECK_EQ(a.mod(1000), 890u);
+        CHECK_EQ(la::gcd(BigInt(-12), BigInt(18)), BigInt(6));
+        CHECK_EQ(la::gcd(a * BigInt(6), a * BigInt(4)), a * BigInt(2));
+    }
+}
@@ -0,0 +1,173 @@
+#include "doctest/doctest.h"
+#include "la/bit_count.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace {
+// Deterministic pseudo-random words (xorshift64).
+std::vector<std::uint64_t> random_words(std::size_t n, std::uint64_t seed) {
+    std::vector<std::uint64_t> w(n);
+    for (std::uint64_t &x : w) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        x = seed;
+    }
+    return w;
+}
+
+std::size_t naive_weight(const std::uint64_t *w, std::size_t n) {
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < 64 * n; ++i) {
+        c += (w[i / 64] >> (i % 64)) & 1u;
+    }
+    return c;
+}
+
+// Runs the checks with every kernel this CPU supports, then restores the
+// kernel that was in use.
+template <typename F> void for_each_kernel(F check) {
+    using la::PopcountKernel;
+    const PopcountKernel saved = la::popcount_kernel();
+    for (PopcountKernel k : {PopcountKernel::Portable, PopcountKernel::Popcnt,
+                             PopcountKernel::Avx512}) {
+        if (la::set_popcount_kernel(k)) {
+            CAPTURE(static_cast<int>(k));
+            check();
+        }
+    }
+    CHECK(la::set_popcount_kernel(saved));
+}
+} // namespace
+
+TEST_CASE("the fastest kernel the CPU has is picked automatically") {
+    // Nothing before this case switches kernels without restoring them.
+    using la::PopcountKernel;
+    const PopcountKernel picked = la::popcount_kernel();
+    for (PopcountKernel k : {PopcountKernel::Popcnt, PopcountKernel::Avx512}) {
+        if (k > picked) {
+            CHECK_FALSE(la::set_popcount_kernel(k));
+        }
+    }
+    CHECK(la::set_popcount_kernel(picked));
+}
+
+TEST_CASE("every kernel agrees with the portable one") {
+    // All lengths around the eight-word blocks of the AVX-512 kernel, at
+    // every word offset within a block.
+    using la::PopcountKernel;
+    const std::vector<std::uint64_t> a = random_words(80, 5);
+    const std::vector<std::uint64_t> b = random_words(80, 6);
+    const PopcountKernel saved = la::popcount_kernel();
+    for (std::size_t off = 0; off < 8; ++off) {
+        for (std::size_t n = 0; off + n <= 64; ++n) {
+            REQUIRE(la::set_popcount_kernel(PopcountKernel::Portable));
+            const std::size_t c = la::popcount(a.data() + off, n);
+            const std::size_t d =
+                la::hamming_distance(a.data() + off, b.data() + off, n);
+            std::vector<std::uint32_t> w;
+            std::vector<std::uint32_t> rd;
+            la::record_weights(a.data() + off, n, 1, w);
+            la::pairwise_hamming_distances(a.data() + off, n, 1, rd);
+            for_each_kernel([&] {
+                CAPTURE(off);
+                CAPTURE(n);
+                CHECK_EQ(la::popcount(a.data() + off, n), c);
+                CHECK_EQ(la::hamming_distance(a.data() + off,
+                                              b.data() + off, n),
+                         d);
+                std::vector<std::uint32_t> wk;
+                std::vector<std::uint32_t> rdk;
+                la::record_weights(a.data() + off, n, 1, wk);
+                la::pairwise_hamming_distances(a.data() + off, n, 1, rdk);
+                CHECK(wk == w);
+                CHECK(rdk == rd);
+            });
+        }
+    }
+    CHECK(la::set_popcount_kernel(saved));
+}
+
+TEST_CASE("popcount, parity and hamming_distance over word buffers") {
+    for_each_kernel([] {
+        const std::vector<std::uint64_t> a = random_words(37, 1);
+        const std::vector<std::uint64_t> b = random_words(37, 2);
+        for (std::size_t n : {0, 1, 7, 8, 13, 37}) {
+            const std::size_t c = naive_weight(a.data(), n);
+            CHECK_EQ(la::popcount(a.data(), n), c);
+            CHECK_EQ(la::parity(a.data(), n), c % 2 == 1);
+
+            std::vector<std::uint64_t> x(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                x[i] = a[i] ^ b[i];
+            }
+            CHECK_EQ(la::hamming_distance(a.data(), b.data(), n),
+                     naive_weight(x.data(), n));
+        }
+    });
+}
+
+TEST_CASE("record weights and parities of 64- to 512-bit records") {
+    for_each_kernel([] {
+        const std::vector<std::uint64_t> w = random_words(8 * 21, 3);
+        for (std::size_t rw : {1, 2, 3, 8}) {
+            const std::size_t count = w.size() / rw;
+            std::vector<std::uint32_t> weights{99};
+            la::record_weights(w.data(), count, rw, weights);
+            la::BitVector parities;
+            la::record_parities(w.data(), count, rw, parities);
+            REQUIRE_EQ(weights.size(), count);
+            REQUIRE_EQ(parities.size(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::size_t c = naive_weight(w.data() + i * rw, rw);
+                CHECK_EQ(weights[i], c);
+                CHECK_EQ(parities[i], c % 2 == 1);
+            }
+        }
+    });
+}
+
+TEST_CASE("pairwise Hamming distances") {
+    for_each_kernel([] {
+        const std::vector<std::uint64_t> w = random_words(2 * 19, 4);
+        for (std::size_t rw : {1, 2}) {
+            const std::size_t count = 19;
+            std::vector<std::uint32_t> d;
+            la::pairwise_hamming_distances(w.data(), count, rw, d);
+            REQUIRE_EQ(d.size(), count * count);
+            for (std::size_t i = 0; i < count; ++i) {
+                CHECK_EQ(d[i * count + i], 0);
+                for (std::size_t j = 0; j < count; ++j) {
+                    CHECK_EQ(d[i * count + j],
+                             la::hamming_distance(w.data() + i * rw,
+                                                  w.data() + j * rw, rw));
+                }
+            }
+        }
+    });
+
+    const la::BitMatrix A(3, 70, {1, 0, 1, 1, 0, 0, 1, 0, 1, 1, //
+                                  1, 0, 1, 1, 0, 0, 1, 0, 1, 1, //
+                                  1, 0, 1, 1, 0, 0, 1, 0, 1, 1, //
+                                  1, 0, 1, 1, 0, 0, 1, 0, 1, 1, //
+                                  1, 0, 1, 1, 0, 0, 1, 0, 1, 1, //
+                                  1, 0, 1, 1, 0, 0, 1, 0, 1, 1, //
+                                  1, 0, 1, 1, 0, 0, 1, 0, 1, 1, //
+                                  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+                                  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+                                  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+                                  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+                                  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+                                  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+                                  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+                                  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //
+                                  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //
+                                  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //
+                                  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //
+                                  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //
+                                  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //
+                                  1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+    CHECK(la::row_parities(A) == la::BitVector{0, 0, 0});
+    const std::vector<std::uint32_t> d = la::pairwise_hamming_distances(A);
+    CHECK(d == std::vector<std::uint32_t>{0, 42, 28, 42, 0, 70, 28, 70, 0});
+}
@@ -0,0 +1,141 @@
+#include "doctest/doctest.h"
+#include "la/bit_matrix.hpp"
+#include "test_utils.hpp"
+#include <stdexcept>
+#include <vector>
+
+namespace {
+// Plain one-column-at-a-time elimination for reference.
+std::size_t naive_rank(la::BitMatrix A) {
+    std::size_t r = 0;
+    for (std::size_t c = 0; c < A.cols() && r < A.rows(); ++c) {
+        std::size_t p = r;
+        while (p < A.rows() && !A(p, c)) {
+            ++p;
+        }
+        if (p == A.rows())
+            continue;
+        A.exchange_rows(r, p);
+        for (std::size_t i = 0; i < A.rows(); ++i) {
+            if (i != r && A(i, c)) {
+                A.xor_rows(i, r);
+            }
+        }
+        ++r;
+    }
+    return r;
+}
+
+bool is_zero(const la::BitVector &v) { return v.weight() == 0; }
+} // namespace
+
+TEST_CASE("BitVector and BitMatrix storage") {
+    using la::BitMatrix;
+    using la::BitVector;
+
+    BitVector v{1, 0, 1, 1};
+    CHECK_EQ(v.size(), 4);
+    CHECK(v[0]);
+    CHECK_FALSE(v[1]);
+    CHECK_EQ(v.weight(), 3);
+    CHECK(v.parity());
+    v.flip(3);
+    CHECK_FALSE(v.parity());
+    CHECK_THROWS_AS(v ^= BitVector(5), std::invalid_argument);
+
+    BitMatrix A(2, 70);
+    A.set(1, 69);
+    A.set(1, 3);
+    CHECK(A(1, 69));
+    CHECK_EQ(A.stride(), 2);
+    CHECK_EQ(A.row_weight(1), 2);
+    CHECK_FALSE(A.row_parity(1));
+    CHECK_THROWS_AS(A.at(2, 0), std::out_of_range);
+    CHECK_EQ(transpose(transpose(A)), A);
+    CHECK_THROWS_AS(BitMatrix(2, 2, {1, 0, 1}), std::invalid_argument);
+}
+
+TEST_CASE("BitMatrix products") {
+    using la::BitMatrix;
+    using la::BitVector;
+
+    // clang-format off
+    BitMatrix A(2, 3, {
+        1, 1, 0,
+        0, 1, 1
+    });
+    // clang-format on
+    CHECK_EQ(A * BitVector{1, 1, 1}, (BitVector{0, 0}));
+    CHECK_EQ(A * BitVector{1, 0, 0}, (BitVector{1, 0}));
+    CHECK_EQ(A * la::bit_identity(3), A);
+    CHECK_EQ(A * transpose(A), BitMatrix(2, 2, {0, 1, 1, 0}));
+    CHECK_THROWS_AS(A * BitVector(2), std::invalid_argument);
+}
+
+TEST_CASE("GF(2) elimination") {
+    using la::BitMatrix;
+    using la::BitVector;
+
+    SUBCASE("small RREF") {
+        // clang-format off
+        BitMatrix A(3, 4, {
+            1, 1, 0, 1,
+            1, 0, 1, 1,
+            0, 1, 1, 0
+        });
+        BitMatrix expected(3, 4, {
+            1, 0, 1, 1,
+            0, 1, 1, 0,
+            0, 0, 0, 0
+        });
+        // clang-format on
+        la::PivotInfo info = rref_inplace(A);
+        CHECK_EQ(A, expected);
+        CHECK_EQ(info.pivot_cols, std::vector<std::size_t>{0, 1});
+        CHECK_EQ(info.free_cols, std::vector<std::size_t>{2, 3});
+    }
+
+    SUBCASE("rank matches plain elimination across many strips") {
+        for (std::uint64_t seed = 1; seed <= 6; ++seed) {
+            BitMatrix A = random_bits(40 + seed * 7, 130, seed);
+            CHECK_EQ(la::rank(A), naive_rank(A));
+        }
+        // Dependent rows: the last rows are sums of earlier ones.
+        BitMatrix B = random_bits(30, 100, 42);
+        for (std::size_t i = 20; i < 30; ++i) {
+            for (std::size_t j = 0; j < 100; ++j) {
+                B.set(i, j, B(i - 20, j) != B(i - 19, j));
+            }
+        }
+        CHECK_EQ(la::rank(B), naive_rank(B));
+        CHECK(la::rank(B) <= 20);
+    }
+
+    SUBCASE("solve and null space") {
+        BitMatrix A = random_bits(50, 90, 7);
+        BitVector x0(90);
+        for (std::size_t j = 0; j < 90; j += 3) {
+            x0.set(j);
+        }
+        BitVector b = A * x0;
+
+        BitVector x;
+        REQUIRE(la::solve(A, b, x));
+        CHECK_EQ(A * x, b);
+
+        BitMatrix N = la::null_space(A);
+        CHECK_EQ(N.rows(), 90 - la::rank(A));
+        CHECK_EQ(la::rank(N), N.rows());
+        for (std::size_t k = 0; k < N.rows(); ++k) {
+            CHECK(is_zero(A * N.row(k)));
+        }
+    }
+
+    SUBCASE("inconsistent system") {
+        BitMatrix A(2, 2, {1, 1, 1, 1});
+        BitVector x{1, 1};
+        CHECK_FALSE(la::solve(A, BitVector{1, 0}, x));
+        CHECK_EQ(x, (BitVector{1, 1})); // untouched
+        CHECK_THROWS_AS(la::solve(A, BitVector(3), x), std::invalid_argument);
+    }
+}
@@ -0,0 +1,100 @@
+#include "doctest/doctest.h"
+#include "la/check_digits.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+template <typename S> bool valid(const std::string &code) {
+    REQUIRE_EQ(code.size(), S::length);
+    return S::valid(code.data());
+}
+
+template <typename S> std::string completed(std::string code) {
+    REQUIRE_EQ(code.size(), S::length);
+    CHECK(S::complete(&code[0]));
+    return code;
+}
+} // namespace
+
+TEST_CASE("EAN-13 and ISBN-13") {
+    CHECK(valid<la::Ean13>("4006381333931"));
+    CHECK(valid<la::Isbn13>("9780306406157"));
+    CHECK_FALSE(valid<la::Isbn13>("9780306406158"));
+    CHECK_FALSE(valid<la::Isbn13>("97803064O6157"));
+    CHECK_EQ(completed<la::Isbn13>("978030640615?"), "9780306406157");
+}
+
+TEST_CASE("ISBN-10 with X check character") {
+    CHECK(valid<la::Isbn10>("0306406152"));
+    CHECK(valid<la::Isbn10>("080442957X"));
+    CHECK_FALSE(valid<la::Isbn10>("0804429571"));
+    CHECK_FALSE(valid<la::Isbn10>("X804429570"));
+    CHECK_EQ(completed<la::Isbn10>("080442957-"), "080442957X");
+}
+
+TEST_CASE("Luhn") {
+    using Card = la::Luhn<16>;
+    CHECK(valid<la::Luhn<11>>("79927398713"));
+    CHECK_FALSE(valid<la::Luhn<11>>("79927398710"));
+    CHECK(valid<Card>("4539578763621486"));
+    CHECK_FALSE(valid<Card>("4539578763621468")); // adjacent swap
+    CHECK_EQ(completed<Card>("453957876362148?"), "4539578763621486");
+}
+
+TEST_CASE("Verhoeff") {
+    CHECK(valid<la::Verhoeff<4>>("2363"));
+    CHECK_EQ(completed<la::Verhoeff<4>>("236?"), "2363");
+    CHECK_EQ(completed<la::Verhoeff<6>>("12345?"), "123451");
+    CHECK(valid<la::Verhoeff<6>>("123451"));
+
+    // Every adjacent transposition of distinct digits is detected.
+    std::string code = "8473643095";
+    CHECK(la::Verhoeff<10>::complete(&code[0]));
+    for (std::size_t p = 0; p + 1 < code.size(); ++p) {
+        std::string swapped = code;
+        std::swap(swapped[p], swapped[p + 1]);
+        if (swapped != code) {
+            CHECK_FALSE(valid<la::Verhoeff<10>>(swapped));
+        }
+    }
+}
+
+TEST_CASE("IBAN mod 97") {
+    using Iban22 = la::Iban<22>;
+    CHECK(valid<Iban22>("GB82WEST12345698765432"));
+    CHECK(valid<Iban22>("DE89370400440532013000"));
+    CHECK_FALSE(valid<Iban22>("GB82WEST12345698765423"));
+    CHECK_FALSE(valid<Iban22>("GB82west12345698765432"));
+    CHECK_EQ(completed<Iban22>("GB??WEST12345698765432"),
+             "GB82WEST12345698765432");
+
+    std::string bad = "GB??WE-T12345698765432";
+    CHECK_FALSE(Iban22::complete(&bad[0]));
+    CHECK_EQ(bad, "GB??WE-T12345698765432");
+}
+
+TEST_CASE("find_code_errors and complete_codes share one bulk path") {
+    const std::string text = "4006381333931\n"
+                             "9780306406157\n"
+                             "9780306406158\n"
+                             "978030640615?\n";
+    la::BitVector failed;
+    CHECK_EQ(2, la::find_code_errors<la::Ean13>(text.data(), 4, 14, failed));
+    CHECK(failed == la::BitVector{0, 0, 1, 1});
+
+    std::vector<std::size_t> failures;
+    CHECK_EQ(2,
+             la::find_code_errors<la::Ean13>(text.data(), 4, 14, failures));
+    CHECK(failures == std::vector<std::size_t>{2, 3});
+
+    std::string ibans = "GB??WEST12345698765432DE??370400440532013000";
+    CHECK_EQ(0, la::complete_codes<la::Iban<22>>(&ibans[0], 2, 22));
+    CHECK_EQ(ibans, "GB82WEST12345698765432DE89370400440532013000");
+
+    CHECK_THROWS_AS(la::find_code_errors<la::Ean13>(text.data(), 4, 12,
+                                                    failed),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(la::complete_codes<la::Luhn<11>>(&ibans[0], 1, 10),
+                    std::invalid_argument);
+}
@@ -0,0 +1,154 @@
+#include "doctest/doctest.h"
+#include "la/cholesky.hpp"
+#include "la/determinant.hpp"
+#include "la/matrix.hpp"
+#include "la/matrix_transforms.hpp"
+#include "la/symmetric_matrix.hpp"
+#include "la/triangular_matrix.hpp"
+#include "la/vector.hpp"
+#include "la/workspace.hpp"
+#include "test_utils.hpp"
+
+namespace {
+bool near(const la::Matrix &A, const la::Matrix &B) {
+    return la::approx_equal(A, B, 1e-10, 1e-9);
+}
+} // namespace
+
+TEST_CASE("Cholesky factorization") {
+    using la::Cholesky;
+    using la::Matrix;
+    using la::Vector;
+
+    // clang-format off
+    Matrix A(3, 3, {
+        4, 2, -2,
+        2, 5,  1,
+       -2, 1,  6
+    });
+    // clang-format on
+
+    SUBCASE("L L^T reproduces A") {
+        Cholesky ch(A);
+        Matrix L = to_matrix(ch.factor());
+        CHECK_NEAR(L * transpose(L), A);
+        CHECK_EQ(ch.determinant(), doctest::Approx(la::determinant(A)));
+    }
+
+    SUBCASE("solves vectors and matrices") {
+        Cholesky ch(A);
+        Vector b({2, -1, 3});
+        CHECK_NEAR(A * ch.solve(b), b);
+        Matrix B(3, 2, {1, 0, 0, 1, 2, 2});
+        CHECK_NEAR(A * ch.solve(B), B);
+    }
+
+    SUBCASE("rejects matrices that are not positive definite") {
+        Matrix I = la::identity(2);
+        CHECK_THROWS_AS(Cholesky(I * -1.0), std::domain_error);
+        CHECK_THROWS_AS(Cholesky(Matrix(2, 2, {1, 2, 2, 4})),
+                        std::domain_error);
+        CHECK_THROWS_AS(Cholesky(Matrix(2, 3)), std::invalid_argument);
+        CHECK_THROWS_AS(Cholesky(A).solve(Vector({1, 2})),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("Cholesky updates and downdates") {
+    using la::Cholesky;
+    using la::Matrix;
+    using la::Vector;
+
+    // clang-format off
+    Matrix A(4, 4, {
+        6, 1, 0, 2,
+        1, 5, 1, 0,
+        0, 1, 4, 1,
+        2, 0, 1, 7
+    });
+    // clang-format on
+    Cholesky ch(A);
+    Vector x({1, -1, 2, 0.5});
+
+    SUBCASE("update then downdate returns to A") {
+        ch.update(x);
+        Matrix X(4, std::size_t{1}, x);
+        Matrix updated = A + X * transpose(X);
+        CHECK(near(to_matrix(ch.matrix()), updated));
+        Matrix L = to_matrix(ch.factor());
+        CHECK(near(L * transpose(L), updated));
+
+        ch.downdate(x);
+        L = to_matrix(ch.factor());
+        CHECK(near(L * transpose(L), A));
+        CHECK(near(to_matrix(ch.matrix()), A));
+    }
+
+    SUBCASE("rank-two update") {
+        Matrix X(4, 2, {1, 0, 0, 1, 1, -1, 2, 0});
+        ch.update(X);
+        Matrix updated = A + X * transpose(X);
+        Vector b({1, 2, 3, 4});
+        CHECK(la::approx_equal(updated * ch.solve(b), b, 1e-10, 1e-9));
+    }
+
+    SUBCASE("downdate that loses definiteness throws and keeps state") {
+        Vector big({3, 0, 0, 0}); // A(0, 0) - 9 < 0
+        la::TriangularMatrix before = ch.factor();
+        CHECK_THROWS_AS(ch.downdate(big), std::domain_error);
+        CHECK_EQ(ch.factor(), before);
+        CHECK_EQ(to_matrix(ch.matrix()), A);
+    }
+
+    SUBCASE("shape errors") {
+        CHECK_THROWS_AS(ch.update(Vector({1, 2})), std::invalid_argument);
+        CHECK_THROWS_AS(ch.downdate(Matrix(3, 1)), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Cholesky with a workspace") {
+    using la::Cholesky;
+    using la::Matrix;
+    using la::Vector;
+
+    // clang-format off
+    Matrix A(4, 4, {
+        6, 1, 0, 2,
+        1, 5, 1, 0,
+        0, 1, 4, 1,
+        2, 0, 1, 7
+    });
+    // clang-format on
+    Cholesky ch(A);
+    la::Workspace ws;
+    Matrix X(4, 2, {1, 0, 0, 1, 1, -1, 2, 0});
+
+    SUBCASE("solves match the plain overloads") {
+        Vector b({1, 2, 3, 4});
+        Vector x{9};
+        ch.solve(b, x, ws);
+        CHECK_NEAR(x, ch.solve(b));
+        Matrix Y(1, 1);
+        ch.solve(X, Y, ws);
+        CHECK_NEAR(Y, ch.solve(X));
+    }
+
+    SUBCASE("update then downdate returns to A") {
+        ch.update(X, ws);
+        Matrix L = to_matrix(ch.factor());
+        CHECK(near(L * transpose(L), A + X * transpose(X)));
+        ch.downdate(X, ws);
+        L = to_matrix(ch.factor());
+        CHECK(near(L * transpose(L), A));
+        CHECK(near(to_matrix(ch.matrix()), A));
+    }
+
+    SUBCASE("failed downdate keeps A") {
+        Matrix big(std::size_t{4}, std::size_t{1});
+        big(0, 0) = 3.0;
+        CHECK_THROWS_AS(ch.downdate(big, ws), std::domain_error);
+        CHECK_EQ(to_matrix(ch.matrix()), A);
+        Matrix L = to_matrix(ch.factor());
+        CHECK(near(L * transpose(L), A));
+    }
+}
@@ -0,0 +1,223 @@
+#include "doctest/doctest.h"
+#include "la/big_int.hpp"
+#include "la/exact.hpp"
+#include "la/linear_system.hpp"
+#include "la/matrix.hpp"
+#include "la/vector.hpp"
+#include "test_utils.hpp"
+
+namespace {
+// u u^T + I with u = (1, 2, ..., n): entries grow quickly with n, so the
+// Hadamard bound needs several primes.
+la::Matrix rank_one_plus_identity(std::size_t n) {
+    la::Matrix A(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            A(i, j) = static_cast<double>((i + 1) * (j + 1));
+        }
+        A(i, i) += 1.0;
+    }
+    return A;
+}
+} // namespace
+
+TEST_CASE("exact_rank and exact_determinant") {
+    using la::BigInt;
+    using la::Matrix;
+
+    SUBCASE("small matrices") {
+        // clang-format off
+        Matrix A(3, 3, {
+            2, 0, 1,
+            1, 3, 2,
+            1, 1, 2
+        });
+        // clang-format on
+        CHECK_EQ(la::exact_rank(A), 3);
+        CHECK_EQ(la::exact_determinant(A), BigInt(6));
+
+        Matrix S(3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+        CHECK_EQ(la::exact_rank(S), 2);
+        CHECK_EQ(la::exact_determinant(S), BigInt(0));
+        CHECK_EQ(la::exact_rank(Matrix(2, 3)), 0);
+        CHECK_EQ(la::exact_determinant(Matrix(0, 0)), BigInt(1));
+    }
+
+    SUBCASE("rank of a nearly dependent matrix") {
+        // Row 2 differs from row 0 + row 1 only by 1 in its last entry,
+        // far below the tolerance of the floating-point rank.
+        const double big = 1099511627776.0; // 2^40
+        Matrix A(3, 3, {big, 1, 0, 0, big, 1, big, big + 1, 2});
+        CHECK_EQ(la::exact_rank(A), 3);
+        A(2, 2) = 1;
+        CHECK_EQ(la::exact_rank(A), 2);
+    }
+
+    SUBCASE("determinant larger than 64 bits") {
+        // diag(2^40, 2^40, 3) has determinant 3 * 2^80.
+        const double big = 1099511627776.0;
+        Matrix A(3, 3, {big, 0, 0, 1, big, 0, 5, 7, -3});
+        CHECK_EQ(la::exact_determinant(A, 2),
+                 BigInt("-3626777458843887524118528"));
+    }
+
+    SUBCASE("many primes on several threads") {
+        Matrix A = rank_one_plus_identity(12);
+        const BigInt d1 = la::exact_determinant(A, 1);
+        CHECK_EQ(la::exact_determinant(A, 4), d1);
+        CHECK_EQ(la::exact_rank(A, 3), 12);
+    }
+
+    SUBCASE("invalid input") {
+        CHECK_THROWS_AS(la::exact_rank(Matrix(2, 1, {0.5, 1})),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(la::exact_determinant(Matrix(2, 3)),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("exact_solve") {
+    using la::BigInt;
+    using la::Matrix;
+    using la::SolutionKind;
+    using la::Vector;
+
+    SUBCASE("unique rational solution") {
+        // clang-format off
+        Matrix A(3, 3, {
+            2, 1, 1,
+            1, 3, 2,
+            1, 0, 0
+        });
+        // clang-format on
+        Vector b({4, 5, 6});
+        la::ExactSolution sol = la::exact_solve(A, b);
+        REQUIRE_EQ(sol.kind, SolutionKind::Unique);
+        CHECK_NEAR(A * sol.to_vector(), b);
+        CHECK_EQ(sol.denominator, BigInt(1));
+        CHECK_EQ(sol.numerators[0], BigInt(6));
+    }
+
+    SUBCASE("fractions over a common denominator") {
+        Matrix A(2, 2, {3, 1, 1, 3});
+        Vector b({1, 0});
+        la::ExactSolution sol = la::exact_solve(A, b);
+        REQUIRE_EQ(sol.kind, SolutionKind::Unique);
+        // x = (3/8, -1/8)
+        CHECK_EQ(sol.denominator, BigInt(8));
+        CHECK_EQ(sol.numerators[0], BigInt(3));
+        CHECK_EQ(sol.numerators[1], BigInt(-1));
+    }
+
+    SUBCASE("infinite and no solutions") {
+        Matrix A(2, 3, {1, 2, 3, 2, 4, 6});
+        la::ExactSolution sol = la::exact_solve(A, Vector({1, 2}));
+        REQUIRE_EQ(sol.kind, SolutionKind::Infinite);
+        CHECK_NEAR(A * sol.to_vector(), Vector({1, 2}));
+
+        CHECK_EQ(la::exact_solve(A, Vector({1, 3})).kind, SolutionKind::None);
+        CHECK_EQ(la::exact_n_solutions(A, Vector({1, 3})), SolutionKind::None);
+        CHECK(la::exact_is_in_span(A, Vector({2, 4})));
+        CHECK_FALSE(la::exact_is_in_span(A, Vector({2, 5})));
+    }
+
+    SUBCASE("larger system on several threads") {
+        Matrix A = rank_one_plus_identity(10);
+        Vector b(10);
+        for (std::size_t i = 0; i < 10; ++i) {
+            b[i] = static_cast<double>(i % 3);
+        }
+        la::ExactSolution sol = la::exact_solve(A, b, 3);
+        REQUIRE_EQ(sol.kind, SolutionKind::Unique);
+        CHECK(la::approx_equal(A * sol.to_vector(), b, 1e-9, 1e-9));
+    }
+
+    SUBCASE("size mismatch") {
+        CHECK_THROWS_AS(la::exact_solve(Matrix(2, 2), Vector({1, 2, 3})),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("Bareiss fraction-free elimination") {
+    using la::BigInt;
+    using la::Matrix;
+
+    SUBCASE("echelon form keeps integer minors") {
+        // clang-format off
+        Matrix A(3, 4, {
+            2, 1, 1, 3,
+            4, 2, 3, 1,
+            1, 0, 1, 2
+        });
+        // clang-format on
+        la::FractionFreeEchelon E = la::fraction_free_ref(A);
+        CHECK_EQ(E.rank(), 3);
+        CHECK_EQ(E.pivots.pivot_cols, std::vector<std::size_t>{0, 1, 2});
+        CHECK_EQ(E.pivots.free_cols, std::vector<std::size_t>{3});
+        CHECK_EQ(E(0, 0), BigInt(2));
+        // Second pivot: 2x2 minor of rows {0, 2}, columns {0, 1}.
+        CHECK_EQ(E(1, 1), BigInt(-1));
+        CHECK_EQ(E(1, 0), BigInt(0));
+        CHECK_EQ(E(2, 0), BigInt(0));
+        CHECK_EQ(E(2, 1), BigInt(0));
+    }
+
+    SUBCASE("determinant agrees with the multi-modular one") {
+        Matrix A = rank_one_plus_identity(8);
+        CHECK_EQ(la::bareiss_determinant(A), la::exact_determinant(A));
+        Matrix S(3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+        CHECK_EQ(la::bareiss_determinant(S), BigInt(0));
+        Matrix P(2, 2, {0, 1, 1, 0});
+        CHECK_EQ(la::bareiss_determinant(P), BigInt(-1));
+    }
+
+    SUBCASE("falls back to BigInt when 64 bits overflow") {
+        // Entries near 2^40 push the 2x2 minors past 2^63.
+        const double big = 1099511627776.0;
+        const std::size_t n = 6;
+        Matrix A(n, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                A(i, j) = static_cast<double>((i * 7 + j * 3) % 11) - 5.0;
+            }
+            A(i, i) += big;
+        }
+        const BigInt det = la::bareiss_determinant(A);
+        CHECK(det.bit_length() > 200);
+        CHECK_EQ(det, la::exact_determinant(A));
+    }
+
+    SUBCASE("falls back to BigInt when a quotient overflows") {
+        // The second step divides the minor -2^63 by the first pivot -1.
+        const double two_31 = 2147483648.0;
+        Matrix A(3, 3);
+        A(0, 0) = -1.0;
+        A(1, 1) = -2.0 * two_31;
+        A(2, 2) = two_31;
+        const BigInt det = la::bareiss_determinant(A);
+        CHECK_EQ(det.bit_length(), 64);
+        CHECK_EQ(det, la::exact_determinant(A));
+    }
+
+    SUBCASE("larger integer matrix") {
+        const std::size_t n = 40;
+        Matrix A(n, n);
+        unsigned seed = 12345;
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                seed = seed * 1103515245u + 12345u;
+                A(i, j) = static_cast<double>((seed >> 16) % 19) - 9.0;
+            }
+        }
+        const BigInt det = la::bareiss_determinant(A);
+        CHECK_FALSE(det.is_zero());
+        CHECK_EQ(det, la::exact_determinant(A));
+    }
+
+    SUBCASE("invalid input") {
+        CHECK_THROWS_AS(la::bareiss_determinant(Matrix(2, 3)),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(la::fraction_free_ref(Matrix(2, 1, {1.5, 2})),
+                        std::invalid_argument);
+    }
+}
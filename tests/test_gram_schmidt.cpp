@@ -0,0 +1,132 @@
+#include "doctest/doctest.h"
+#include "la/gram_schmidt.hpp"
+#include "la/matrix.hpp"
+#include "la/matrix_products.hpp"
+#include "la/matrix_transforms.hpp"
+#include "test_utils.hpp"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+// Deterministic entries in [-1, 1) from a linear congruential generator.
+la::Matrix random_matrix(std::size_t m, std::size_t n, std::uint64_t seed) {
+    la::Matrix A(m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            A(i, j) = static_cast<double>(seed >> 11) / 4503599627370496.0 -
+                      1.0;
+        }
+    }
+    return A;
+}
+
+// The first r columns of Q.
+la::Matrix leading_columns(const la::Matrix &Q, std::size_t r) {
+    la::Matrix B(Q.rows(), r);
+    for (std::size_t i = 0; i < Q.rows(); ++i) {
+        for (std::size_t j = 0; j < r; ++j) {
+            B(i, j) = Q(i, j);
+        }
+    }
+    return B;
+}
+
+std::vector<std::size_t> iota(std::size_t first, std::size_t last) {
+    std::vector<std::size_t> v;
+    for (std::size_t k = first; k < last; ++k) {
+        v.push_back(k);
+    }
+    return v;
+}
+} // namespace
+
+TEST_CASE("orthonormalize_columns of a full-rank matrix") {
+    using la::Matrix;
+    using la::Op;
+
+    // 40 columns: more than one block.
+    const Matrix A = random_matrix(50, 40, 7);
+    Matrix Q = A;
+    const la::PivotInfo info = la::orthonormalize_columns(Q, 1);
+    CHECK(info.pivot_cols == iota(0, 40));
+    CHECK(info.free_cols.empty());
+
+    CHECK_NEAR(la::multiply(Q, Op::Transpose, Q, Op::None), la::identity(40));
+    // Same span: Q Q^T A = A.
+    CHECK_NEAR(Q * la::multiply(Q, Op::Transpose, A, Op::None), A);
+
+    SUBCASE("triangular factor: Q^T A is upper triangular") {
+        const Matrix R = la::multiply(Q, Op::Transpose, A, Op::None);
+        for (std::size_t i = 0; i < R.rows(); ++i) {
+            for (std::size_t j = 0; j < i; ++j) {
+                CHECK(std::fabs(R(i, j)) < 1e-12);
+            }
+        }
+    }
+}
+
+TEST_CASE("orthonormalize_columns detects rank deficiency") {
+    using la::Matrix;
+    using la::Op;
+
+    // Columns 0-9 random; every later column a combination of them, and
+    // columns 45 and 60 zero.
+    const Matrix B = random_matrix(20, 10, 11);
+    const Matrix W = random_matrix(10, 70, 13);
+    Matrix A = B * W;
+    for (std::size_t j = 0; j < 10; ++j) {
+        for (std::size_t i = 0; i < 20; ++i) {
+            A(i, j) = B(i, j);
+        }
+    }
+    for (std::size_t i = 0; i < 20; ++i) {
+        A(i, 45) = 0.0;
+        A(i, 60) = 0.0;
+    }
+
+    Matrix Q = A;
+    const la::PivotInfo info = la::orthonormalize_columns(Q, 1);
+    CHECK(info.pivot_cols == iota(0, 10));
+    CHECK(info.free_cols == iota(10, 70));
+
+    const Matrix Q10 = leading_columns(Q, 10);
+    CHECK_NEAR(la::multiply(Q10, Op::Transpose, Q10, Op::None),
+               la::identity(10));
+    CHECK_NEAR(Q10 * la::multiply(Q10, Op::Transpose, A, Op::None), A);
+    for (std::size_t i = 0; i < Q.rows(); ++i) {
+        for (std::size_t j = 10; j < Q.cols(); ++j) {
+            CHECK_EQ(Q(i, j), 0.0);
+        }
+    }
+
+    SUBCASE("dependent columns ahead of independent ones are skipped") {
+        Matrix D(3, 4, {1, 2, 0, 1, //
+                        1, 2, 0, 0, //
+                        0, 0, 0, 1});
+        const la::PivotInfo d = la::orthonormalize_columns(D);
+        CHECK(d.pivot_cols == std::vector<std::size_t>{0, 3});
+        CHECK(d.free_cols == std::vector<std::size_t>{1, 2});
+    }
+
+    SUBCASE("empty matrices") {
+        Matrix E(0, 3);
+        CHECK(la::orthonormalize_columns(E).free_cols == iota(0, 3));
+        Matrix F(3, 0);
+        CHECK(la::orthonormalize_columns(F).pivot_cols.empty());
+    }
+}
+
+TEST_CASE("orthonormalize_columns on several threads matches one thread") {
+    const la::Matrix A = random_matrix(700, 100, 17);
+    la::Matrix serial = A;
+    la::Matrix parallel = A;
+    const la::PivotInfo s = la::orthonormalize_columns(serial, 1);
+    const la::PivotInfo p = la::orthonormalize_columns(parallel, 4);
+    CHECK(s.pivot_cols == p.pivot_cols);
+    CHECK_NEAR(serial, parallel);
+    CHECK_NEAR(la::multiply(parallel, la::Op::Transpose, parallel,
+                            la::Op::None),
+               la::identity(100));
+}
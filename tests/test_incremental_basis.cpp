@@ -0,0 +1,95 @@
+#include "doctest/doctest.h"
+#include "la/incremental_basis.hpp"
+#include "la/matrix.hpp"
+#include "la/matrix_transforms.hpp"
+#include "la/vector.hpp"
+#include "la/vector_algorithms.hpp"
+#include "test_utils.hpp"
+
+TEST_CASE("IncrementalBasis grows with independent vectors") {
+    using la::IncrementalBasis;
+    using la::Vector;
+
+    IncrementalBasis basis(3);
+    CHECK_EQ(basis.dim(), 3);
+    CHECK_EQ(basis.rank(), 0);
+    CHECK(basis.contains(Vector(3)));
+    CHECK_FALSE(basis.contains(Vector{1, 0, 0}));
+
+    CHECK(basis.add(Vector{1, 2, 0}));
+    CHECK(basis.add(Vector{0, 1, 1}));
+    CHECK_EQ(basis.rank(), 2);
+
+    SUBCASE("dependent vectors are rejected") {
+        CHECK(basis.contains(Vector{2, 5, 1}));
+        CHECK_FALSE(basis.add(Vector{2, 5, 1}));
+        CHECK_FALSE(basis.add(Vector(3)));
+        CHECK_EQ(basis.rank(), 2);
+    }
+
+    SUBCASE("a full basis contains everything") {
+        CHECK(basis.add(Vector{0, 0, 1}));
+        CHECK(basis.is_full());
+        CHECK(basis.contains(Vector{7, -3, 2}));
+        CHECK_FALSE(basis.add(Vector{7, -3, 2}));
+    }
+
+    SUBCASE("basis rows are orthonormal") {
+        la::Matrix Q = basis.basis();
+        CHECK_EQ(Q.rows(), 2);
+        CHECK_NEAR(Q * la::transpose(Q), la::identity(2));
+    }
+
+    SUBCASE("clear empties the basis") {
+        basis.clear();
+        CHECK_EQ(basis.rank(), 0);
+        CHECK_FALSE(basis.contains(Vector{1, 2, 0}));
+    }
+
+    SUBCASE("size mismatch throws") {
+        CHECK_THROWS_AS(basis.add(Vector{1, 2}), std::invalid_argument);
+        CHECK_THROWS_AS(basis.contains(Vector{1, 2, 3, 4}),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("IncrementalBasis handles nearly dependent and small vectors") {
+    using la::IncrementalBasis;
+    using la::Vector;
+
+    IncrementalBasis basis(2);
+    CHECK(basis.add(Vector{1e-5, 1e-9}));
+    CHECK(basis.add(Vector{1e-9, 1e-5}));
+
+    IncrementalBasis nearly(3);
+    CHECK(nearly.add(Vector{1, 1, 1}));
+    CHECK(nearly.add(Vector{1, 1, 1 + 1e-6}));
+    CHECK_FALSE(nearly.add(Vector{2, 2, 2 + 1e-6}));
+}
+
+TEST_CASE("are_linearly_independent_incremental") {
+    using la::are_linearly_independent_incremental;
+    using la::Vector;
+
+    CHECK(are_linearly_independent_incremental({}));
+    CHECK(are_linearly_independent_incremental({Vector{1, 0}, Vector{1, 1}}));
+    CHECK_FALSE(are_linearly_independent_incremental(
+        {Vector{1, 2, 3}, Vector{2, 4, 6}, Vector{0, 0, 1}}));
+    CHECK_FALSE(are_linearly_independent_incremental(
+        {Vector{1, 0}, Vector{0, 1}, Vector{1, 1}}));
+    CHECK_THROWS_AS(
+        are_linearly_independent_incremental({Vector{1, 0}, Vector{1}}),
+        std::invalid_argument);
+
+    SUBCASE("agrees with are_linearly_independent on clear-cut input") {
+        const std::vector<std::vector<Vector>> sets{
+            {Vector{1, 0, 2}, Vector{0, 1, 1}, Vector{1, 1, 0}},
+            {Vector{1, 0, 2}, Vector{0, 1, 1}, Vector{1, 1, 3}},
+            {Vector{3, -1, 4, 1}, Vector{5, 9, 2, 6}},
+        };
+        for (const auto &vectors : sets) {
+            CHECK_EQ(are_linearly_independent_incremental(vectors),
+                     la::are_linearly_independent(vectors));
+        }
+    }
+}
@@ -0,0 +1,233 @@
+#include "doctest/doctest.h"
+#include "la/incremental_basis.hpp"
+#include "la/instrument.hpp"
+#include "la/linear_system.hpp"
+#include "la/matrix.hpp"
+#include "la/matrix_linear_systems.hpp"
+#include "la/matrix_products.hpp"
+#include "la/matrix_transforms.hpp"
+#include "la/row_reduction.hpp"
+#include "la/shared.hpp"
+#include "la/vector_algorithms.hpp"
+#include "la/workspace.hpp"
+
+// Allocation and copy budgets of the library calls.  The counters are only
+// live in the -DLA_INSTRUMENT build (`make instrument`); elsewhere these
+// cases are skipped.  A failing bound means a call started making extra
+// buffers or deep copies.
+
+namespace {
+using la::instrument::Counters;
+
+constexpr bool kSkip = !la::instrument::kEnabled;
+
+// Counters accumulated while running f().
+template <typename F> Counters cost(F f) {
+    la::instrument::Scope scope;
+    f();
+    return scope.delta();
+}
+
+la::Matrix sample_matrix(std::size_t m, std::size_t n) {
+    la::Matrix A(m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            A(i, j) = static_cast<double>((i * 7 + j * 3) % 11) + (i == j);
+        }
+    }
+    return A;
+}
+} // namespace
+
+TEST_CASE("instrument counters are zero when disabled" *
+          doctest::skip(la::instrument::kEnabled)) {
+    la::Matrix A(3, 3, 1.0);
+    la::Matrix B = A;
+    Counters total = la::instrument::snapshot();
+    CHECK_EQ(total.allocations, 0);
+    CHECK_EQ(total.matrix_copies, 0);
+    CHECK_EQ(B, A);
+}
+
+TEST_CASE("instrument counts allocations, bytes and copies" *
+          doctest::skip(kSkip)) {
+    la::Matrix A(4, 5, 1.0);
+
+    Counters c = cost([&] { la::Matrix B = A; });
+    CHECK_EQ(c.allocations, 1);
+    CHECK_EQ(c.bytes, 20 * sizeof(double));
+    CHECK_EQ(c.matrix_copies, 1);
+
+    c = cost([&] { la::Matrix B = std::move(A); });
+    CHECK_EQ(c.allocations, 0);
+    CHECK_EQ(c.matrix_copies, 0);
+
+    la::Vector v{1, 2, 3};
+    c = cost([&] { la::Vector w = v; });
+    CHECK_EQ(c.allocations, 1);
+    CHECK_EQ(c.vector_copies, 1);
+}
+
+TEST_CASE("Matrix member functions make no hidden copies" *
+          doctest::skip(kSkip)) {
+    la::Matrix A = sample_matrix(6, 6);
+    const la::Matrix B = sample_matrix(6, 6);
+
+    Counters c = cost([&] { CHECK(A.has_same_dimensions(B)); });
+    CHECK_EQ(c.allocations, 0);
+    CHECK_EQ(c.matrix_copies, 0);
+
+    c = cost([&] { A.exchange_rows(1, 4); });
+    CHECK_EQ(c.allocations, 0);
+    CHECK_EQ(c.vector_copies, 0);
+
+    c = cost([&] { CHECK_EQ(A, A); });
+    CHECK_EQ(c.allocations, 0);
+}
+
+TEST_CASE("products and transposes allocate only their result" *
+          doctest::skip(kSkip)) {
+    const la::Matrix A = sample_matrix(5, 4);
+    const la::Matrix B = sample_matrix(4, 3);
+    const la::Vector x{1, 2, 3, 4};
+
+    Counters c = cost([&] { la::Matrix C = A * B; });
+    CHECK_EQ(c.allocations, 1);
+    CHECK_EQ(c.matrix_copies, 0);
+
+    c = cost([&] { la::Vector y = A * x; });
+    CHECK_EQ(c.allocations, 1);
+    CHECK_EQ(c.vector_copies, 0);
+
+    c = cost([&] {
+        la::Matrix C = la::multiply(A, la::Op::Transpose, A, la::Op::None);
+    });
+    CHECK_EQ(c.allocations, 1);
+    CHECK_EQ(c.matrix_copies, 0);
+
+    c = cost([&] { la::Matrix T = la::transpose(A); });
+    CHECK_EQ(c.allocations, 1);
+    CHECK_EQ(c.matrix_copies, 0);
+
+    c = cost([&] { la::Matrix G = la::gram(A); });
+    CHECK_EQ(c.allocations, 1);
+    CHECK_EQ(c.matrix_copies, 0);
+}
+
+TEST_CASE("elimination copies its input at most once" *
+          doctest::skip(kSkip)) {
+    const la::Matrix A = sample_matrix(5, 5);
+    const la::Vector b{1, 2, 3, 4, 5};
+
+    Counters c = cost([&] { la::rank(A); });
+    CHECK_LE(c.allocations, 1);
+    CHECK_LE(c.matrix_copies, 1);
+
+    c = cost([&] { la::Matrix R = la::rref(A); });
+    CHECK_LE(c.allocations, 1);
+    CHECK_LE(c.matrix_copies, 1);
+
+    c = cost([&] {
+        la::Matrix inv;
+        la::inverse(A, inv);
+    });
+    CHECK_LE(c.allocations, 1);
+    CHECK_LE(c.matrix_copies, 1);
+
+    // Working copies of A and b, the right-hand side of the triangular
+    // solve, and the solution; no augmented [A | b].
+    c = cost([&] { la::solve(A, b); });
+    CHECK_LE(c.allocations, 4);
+    CHECK_LE(c.matrix_copies, 1);
+    CHECK_EQ(c.vector_copies, 0);
+}
+
+TEST_CASE("are_linearly_independent does not copy its input" *
+          doctest::skip(kSkip)) {
+    const std::vector<la::Vector> vectors{{1, 0, 2}, {0, 1, 1}, {1, 1, 0}};
+
+    Counters c = cost([&] { CHECK(la::are_linearly_independent(vectors)); });
+    CHECK_EQ(c.vector_copies, 0);
+    CHECK_EQ(c.matrix_copies, 0);
+    CHECK_EQ(c.allocations, 1); // the column matrix
+
+    c = cost([&] {
+        CHECK(la::are_linearly_independent_incremental(vectors));
+    });
+    CHECK_EQ(c.vector_copies, 0);
+    CHECK_EQ(c.matrix_copies, 0);
+    CHECK_EQ(c.allocations, 0); // no column matrix is built
+}
+
+TEST_CASE("shared vector overloads do not copy the vectors" *
+          doctest::skip(kSkip)) {
+    const std::vector<la::SharedVector> vectors{
+        la::SharedVector(la::Vector{1, 0, 2}),
+        la::SharedVector(la::Vector{0, 1, 1})};
+    const la::Vector b{1, 1, 3};
+
+    // Only the column matrix, plus the right-hand side for the span check.
+    Counters c = cost([&] { CHECK(la::are_linearly_independent(vectors)); });
+    CHECK_EQ(c.vector_copies, 0);
+    CHECK_EQ(c.allocations, 1);
+
+    c = cost([&] { CHECK(la::is_in_span(vectors, b)); });
+    CHECK_EQ(c.vector_copies, 0);
+    CHECK_LE(c.allocations, 2);
+}
+
+TEST_CASE("span checks eliminate once without augmenting" *
+          doctest::skip(kSkip)) {
+    const la::Matrix A = sample_matrix(6, 3);
+    const la::Vector b{1, 2, 3, 4, 5, 6};
+    const std::vector<la::Matrix> matrices{sample_matrix(2, 3),
+                                           la::transpose(sample_matrix(3, 2))};
+
+    // Working copies of A and b.
+    Counters c = cost([&] { la::is_in_span(A, b); });
+    CHECK_LE(c.allocations, 2);
+    CHECK_LE(c.matrix_copies, 1);
+
+    // The stacked coefficient matrix and right-hand side; no flatten().
+    c = cost([&] { la::is_linear_combination(matrices[0], matrices); });
+    CHECK_LE(c.allocations, 2);
+    CHECK_EQ(c.matrix_copies, 0);
+    CHECK_EQ(c.vector_copies, 0);
+}
+
+TEST_CASE("workspace calls allocate nothing once warm" *
+          doctest::skip(kSkip)) {
+    const la::Matrix A = sample_matrix(5, 5);
+    const la::Vector b{1, 2, 3, 4, 5};
+    la::Workspace ws;
+    la::Matrix inv(5, 5);
+    la::LinearSystemSolution sol;
+
+    la::rank(A, ws);
+    la::inverse(A, inv, ws);
+    la::solve(A, b, sol, ws);
+
+    Counters c = cost([&] {
+        la::rank(A, ws);
+        la::inverse(A, inv, ws);
+        la::solve(A, b, sol, ws);
+    });
+    CHECK_EQ(c.allocations, 0);
+    CHECK_EQ(c.vector_copies, 0);
+}
+
+TEST_CASE("shared handles copy only on mutation" * doctest::skip(kSkip)) {
+    la::SharedMatrix a(sample_matrix(4, 4));
+
+    Counters c = cost([&] {
+        la::SharedMatrix b = a;
+        la::rank(b);
+    });
+    CHECK_EQ(c.matrix_copies, 1); // inside rank only
+
+    la::SharedMatrix b = a;
+    c = cost([&] { b.mutate()(0, 0) = 1.0; });
+    CHECK_EQ(c.matrix_copies, 1);
+    c = cost([&] { b.mutate()(0, 0) = 2.0; });
+    CHECK_EQ(c.matrix_copies, 0);
+}
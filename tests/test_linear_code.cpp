@@ -0,0 +1,142 @@
+#include "doctest/doctest.h"
+#include "la/linear_code.hpp"
+#include "test_utils.hpp"
+#include <stdexcept>
+
+namespace {
+bool is_zero(const la::BitMatrix &A) {
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        if (A.row_weight(i) != 0)
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("Hamming [7, 4] code encodes and corrects single errors") {
+    using la::BitVector;
+    using la::DecodeStatus;
+
+    const la::LinearCode code = la::LinearCode::hamming(3);
+    CHECK_EQ(code.length(), 7);
+    CHECK_EQ(code.dimension(), 4);
+    CHECK_EQ(code.redundancy(), 3);
+    CHECK(is_zero(code.generator() * la::transpose(code.parity_check())));
+
+    for (unsigned v = 0; v < 16; ++v) {
+        BitVector m(4);
+        for (std::size_t i = 0; i < 4; ++i) {
+            m.set(i, (v >> i) & 1u);
+        }
+        const BitVector c = code.encode(m);
+        CHECK_EQ(code.syndrome(c), 0);
+        CHECK(code.message(c) == m);
+
+        BitVector w = c;
+        CHECK(code.correct(w) == DecodeStatus::Clean);
+        for (std::size_t j = 0; j < 7; ++j) {
+            w = c;
+            w.flip(j);
+            CHECK_NE(code.syndrome(w), 0);
+            CHECK(code.correct(w) == DecodeStatus::Corrected);
+            CHECK(w == c);
+        }
+    }
+
+    CHECK_THROWS_AS(code.encode(BitVector(5)), std::invalid_argument);
+    BitVector wrong(6);
+    CHECK_THROWS_AS(code.correct(wrong), std::invalid_argument);
+    CHECK_THROWS_AS(la::LinearCode::hamming(1), std::invalid_argument);
+}
+
+TEST_CASE("LinearCode bulk encode and correct over packed rows") {
+    const la::LinearCode code = la::LinearCode::hamming(7); // [127, 120]
+    const la::BitMatrix messages = random_bits(200, code.dimension(), 99);
+    const la::BitMatrix C = code.encode(messages);
+    CHECK_EQ(C.rows(), 200);
+    CHECK_EQ(C.cols(), 127);
+
+    for (std::size_t i = 0; i < C.rows(); ++i) {
+        CHECK(code.encode(messages.row(i)) == C.row(i));
+        CHECK(code.message(C.row(i)) == messages.row(i));
+    }
+    for (std::uint32_t s : code.syndromes(C)) {
+        CHECK_EQ(s, 0);
+    }
+
+    // One error in every odd row, spread over all positions.
+    la::BitMatrix W = C;
+    for (std::size_t i = 1; i < W.rows(); i += 2) {
+        W.flip(i, (i * 37) % W.cols());
+    }
+    const la::DecodeSummary summary = code.correct(W);
+    CHECK_EQ(summary.clean, 100);
+    CHECK_EQ(summary.corrected, 100);
+    CHECK(summary.uncorrectable.empty());
+    for (std::size_t i = 0; i < W.rows(); ++i) {
+        CHECK(W.row(i) == C.row(i));
+    }
+}
+
+TEST_CASE("LinearCode from a non-systematic generator") {
+    using la::BitVector;
+    using la::DecodeStatus;
+
+    // Repeat each of two bits three times, interleaved: pivots in columns
+    // 0 and 1, and every error has a distinct syndrome.
+    const la::BitMatrix G(2, 6, {1, 0, 1, 0, 1, 0, //
+                                 0, 1, 0, 1, 0, 1});
+    const la::LinearCode code(G);
+    CHECK_EQ(code.dimension(), 2);
+    CHECK_EQ(code.redundancy(), 4);
+
+    BitVector r = code.encode(BitVector{0, 1});
+    r.flip(2);
+    CHECK(code.correct(r) == la::DecodeStatus::Corrected);
+    CHECK(code.message(r) == BitVector{0, 1});
+
+    // Message bits in columns 1 and 3.
+    const la::BitMatrix S(2, 7, {0, 1, 1, 0, 1, 1, 1, //
+                                 0, 0, 0, 1, 1, 0, 1});
+    const la::LinearCode shifted(S);
+    CHECK(is_zero(shifted.generator() *
+                  la::transpose(shifted.parity_check())));
+    const BitVector m{1, 1};
+    const BitVector c = shifted.encode(m);
+    CHECK_EQ(c.size(), 7);
+    CHECK_EQ(shifted.syndrome(c), 0);
+    CHECK(shifted.message(c) == m);
+    BitVector w = c;
+    w.flip(4);
+    CHECK(shifted.correct(w) == DecodeStatus::Corrected);
+    CHECK(w == c);
+
+    // A code of minimum distance two detects but cannot correct.
+    const la::LinearCode even(la::BitMatrix(2, 3, {1, 0, 1, 0, 1, 1}));
+    BitVector x = even.encode(BitVector{1, 0});
+    x.flip(0);
+    CHECK(even.correct(x) == DecodeStatus::Uncorrectable);
+
+    CHECK_THROWS_AS(la::LinearCode(la::BitMatrix(2, 3, {1, 1, 0, 1, 1, 0})),
+                    std::invalid_argument);
+}
+
+TEST_CASE("LinearCode without parity bits") {
+    using la::BitVector;
+
+    // k = n = 64: the codeword is the message and fills one whole word.
+    const la::LinearCode code(la::bit_identity(64));
+    CHECK_EQ(code.redundancy(), 0);
+
+    BitVector m(64);
+    for (std::size_t i = 0; i < 64; i += 3) {
+        m.set(i, true);
+    }
+    const BitVector c = code.encode(m);
+    CHECK(c == m);
+    CHECK_EQ(code.syndrome(c), 0);
+
+    const la::BitMatrix M = random_bits(3, 64, 7);
+    const la::BitMatrix C = code.encode(M);
+    CHECK(C == M);
+}
@@ -1,6 +1,9 @@
 #include "doctest/doctest.h"
+#include "la/eliminated_system.hpp"
 #include "la/linear_system.hpp"
+#include "la/matrix_linear_systems.hpp"
 #include "la/matrix.hpp"
+#include "la/row_reduction.hpp"
 #include "la/vector.hpp"
 #include "test_utils.hpp"
 
@@ -71,7 +74,7 @@ TEST_CASE("Gaussian elimination") {
         CHECK(sol.has_solution());
         CHECK(sol.is_unique());
         CHECK(!sol.is_infinite());
-        CHECK(sol.directions.size() == 0);
+        CHECK(sol.directions().size() == 0);
         CHECK_EQ(expected_particular, sol.particular);
     }
 
@@ -89,7 +92,7 @@ TEST_CASE("Gaussian elimination") {
         CHECK(!sol.has_solution());
         CHECK(!sol.is_unique());
         CHECK(!sol.is_infinite());
-        CHECK(sol.directions.size() == 0);
+        CHECK(sol.directions().size() == 0);
     }
 
     SUBCASE("Happy case infinite solutions") {
@@ -117,9 +120,9 @@ TEST_CASE("Gaussian elimination") {
         CHECK(sol.has_solution());
         CHECK(!sol.is_unique());
         CHECK(sol.is_infinite());
-        CHECK_EQ(sol.directions.size(), 2);
+        CHECK_EQ(sol.directions().size(), 2);
         CHECK_EQ(expected_particular, sol.particular);
-        CHECK_EQ(expected_directions, sol.directions);
+        CHECK_EQ(expected_directions, sol.directions());
     }
 
     SUBCASE("Partial pivoting") {
@@ -139,3 +142,172 @@ TEST_CASE("Gaussian elimination") {
         CHECK_NEAR(expected_particular, sol.particular);
     }
 }
+
+TEST_CASE("eliminate_system_inplace") {
+    using la::Matrix;
+    using la::Vector;
+
+    // clang-format off
+    Matrix A(3, 4, {
+         1, -1, -1, 2,
+         2, -2, -1, 3,
+        -1,  1, -1, 0
+    });
+    // clang-format on
+
+    SUBCASE("consistent system matches eliminate_system") {
+        Vector b({1, 3, -3});
+        Matrix Ab = augment(A, b);
+        la::EliminationInfo info = eliminate_system_inplace(Ab);
+        la::EliminatedSystem es = eliminate_system(A, b);
+
+        CHECK_EQ(Ab, es.R);
+        CHECK(!info.inconsistent);
+        CHECK_EQ(info.pivots.pivot_cols, std::vector<std::size_t>{0, 2});
+        CHECK_EQ(info.pivots.free_cols, std::vector<std::size_t>{1, 3});
+    }
+
+    SUBCASE("pivot in the RHS column means inconsistent") {
+        Vector b({1, 3, 0});
+        Matrix Ab = augment(A, b);
+        la::EliminationInfo info = eliminate_system_inplace(Ab);
+
+        CHECK(info.inconsistent);
+        CHECK_EQ(info.pivots.pivot_cols, std::vector<std::size_t>{0, 2});
+        CHECK_EQ(info.pivots.free_cols, std::vector<std::size_t>{1, 3});
+    }
+
+    SUBCASE("matrix without RHS column throws") {
+        Matrix empty;
+        CHECK_THROWS_AS(eliminate_system_inplace(empty),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("solve with several right-hand sides") {
+    using la::LinearSystemSolution;
+    using la::Matrix;
+    using la::SolutionKind;
+    using la::Vector;
+
+    // clang-format off
+    Matrix A(3, 3, {
+        1, -1,  2,
+        1,  2, -1,
+        0,  2, -2
+    });
+    // Columns: a consistent and an inconsistent right-hand side.
+    Matrix B(3, 2, {
+        3,  3,
+        6, -3,
+        2,  1
+    });
+    // clang-format on
+
+    std::vector<LinearSystemSolution> sols = solve_many(A, B);
+    REQUIRE_EQ(sols.size(), 2);
+
+    CHECK(sols[0].kind == SolutionKind::Infinite);
+    CHECK_NEAR(A * sols[0].particular, Vector({3, 6, 2}));
+    REQUIRE_EQ(sols[0].null_space.cols(), 1);
+    CHECK_NEAR(A * sols[0].null_space.column(0), Vector(3));
+
+    CHECK(sols[1].kind == SolutionKind::None);
+    CHECK(sols[1].particular.empty());
+
+    SUBCASE("each column matches a single solve") {
+        LinearSystemSolution single = solve(A, B.column(0));
+        CHECK(single.kind == sols[0].kind);
+        CHECK_NEAR(single.particular, sols[0].particular);
+    }
+
+    SUBCASE("row count mismatch throws") {
+        CHECK_THROWS_AS(solve_many(A, Matrix(2, 1)), std::invalid_argument);
+    }
+
+    SUBCASE("full column rank gives unique solutions") {
+        // clang-format off
+        Matrix C(4, 2, {
+            1, 2,
+            3, 4,
+            0, 1,
+            2, 2
+        });
+        // clang-format on
+        Vector x{1, -1};
+        Matrix Bc(4, 2);
+        for (std::size_t i = 0; i < 4; ++i) {
+            Bc(i, 0) = (C * x)[i];
+            Bc(i, 1) = 1.0;
+        }
+        std::vector<LinearSystemSolution> full = solve_many(C, Bc);
+        REQUIRE_EQ(full.size(), 2);
+        CHECK(full[0].is_unique());
+        CHECK_NEAR(full[0].particular, x);
+        CHECK_EQ(full[0].null_space.rows(), 2);
+        CHECK_EQ(full[0].null_space.cols(), 0);
+        CHECK(!full[1].has_solution());
+    }
+}
+
+TEST_CASE("unique solutions have an n x 0 null space") {
+    using la::LinearSystemSolution;
+    using la::Matrix;
+    using la::Vector;
+
+    Matrix A(3, 2, {1, 2, 3, 4, 0, 1});
+    Vector b{-1, -1, -1};
+
+    LinearSystemSolution plain = la::solve(A, b);
+    la::Workspace ws;
+    LinearSystemSolution reused;
+    la::solve(A, b, reused, ws);
+
+    REQUIRE(plain.is_unique());
+    REQUIRE(reused.is_unique());
+    CHECK_EQ(plain.null_space.rows(), 2);
+    CHECK_EQ(plain.null_space.cols(), 0);
+    CHECK_EQ(plain.null_space.rows(), reused.null_space.rows());
+    CHECK_EQ(plain.null_space.cols(), reused.null_space.cols());
+}
+
+TEST_CASE("solve with a braced right-hand side") {
+    using la::LinearSystemSolution;
+    using la::Matrix;
+    using la::Vector;
+
+    // Must resolve to solve(const Matrix &, const Vector &).
+    Matrix A(2, 2, {2, 0, 0, 4});
+    LinearSystemSolution sol = la::solve(A, {1.0, 2.0});
+    CHECK(sol.is_unique());
+    CHECK_NEAR(sol.particular, Vector({0.5, 0.5}));
+}
+
+TEST_CASE("solve returns the null space as a matrix") {
+    using la::LinearSystemSolution;
+    using la::Matrix;
+    using la::Vector;
+
+    // Wide system: 3 equations, 8 unknowns, so 5 free variables.
+    Matrix A(3, 8);
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 8; ++j) {
+            A(i, j) = static_cast<double>((i + 1) * (j + 2) % 7) - 2.0;
+        }
+    }
+    Vector b{1, 2, 3};
+
+    LinearSystemSolution sol = solve(A, b);
+    REQUIRE(sol.is_infinite());
+    CHECK_EQ(sol.null_space.rows(), 8);
+    CHECK_EQ(sol.null_space.cols(), 5);
+    CHECK_NEAR(A * sol.particular, b);
+    CHECK_NEAR(A * sol.null_space, Matrix(3, 5));
+    CHECK_EQ(la::rank(sol.null_space), 5);
+
+    std::vector<Vector> directions = sol.directions();
+    REQUIRE_EQ(directions.size(), 5);
+    for (std::size_t j = 0; j < directions.size(); ++j) {
+        CHECK_EQ(directions[j], sol.null_space.column(j));
+    }
+}
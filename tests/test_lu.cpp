@@ -0,0 +1,180 @@
+#include "doctest/doctest.h"
+#include "la/determinant.hpp"
+#include "la/lu.hpp"
+#include "la/matrix.hpp"
+#include "la/matrix_transforms.hpp"
+#include "la/vector.hpp"
+#include "la/workspace.hpp"
+#include "test_utils.hpp"
+
+namespace {
+// Diagonally dominant, so it and small changes of it are well conditioned.
+la::Matrix dominant_matrix(std::size_t n) {
+    la::Matrix A(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            A(i, j) = static_cast<double>((3 * i + 5 * j) % 7) - 3.0;
+        }
+        A(i, i) += 4.0 * static_cast<double>(n);
+    }
+    return A;
+}
+
+la::Matrix column(std::size_t n, std::size_t seed) {
+    la::Matrix u(n, std::size_t{1});
+    for (std::size_t i = 0; i < n; ++i) {
+        u(i, 0) = static_cast<double>((i * seed + 1) % 5) - 2.0;
+    }
+    return u;
+}
+
+bool near(const la::Matrix &A, const la::Matrix &B) {
+    return la::approx_equal(A, B, 1e-10, 1e-9);
+}
+} // namespace
+
+TEST_CASE("LU factorization") {
+    using la::LU;
+    using la::Matrix;
+    using la::Vector;
+
+    SUBCASE("solves a system that needs pivoting") {
+        // clang-format off
+        Matrix A(3, 3, {
+            0, 2, 1,
+            1, 1, 0,
+            3, 0, 1
+        });
+        // clang-format on
+        LU lu(A);
+        CHECK_FALSE(lu.is_singular());
+        Vector b({3, 2, 4});
+        CHECK_NEAR(A * lu.solve(b), b);
+        CHECK_EQ(lu.determinant(), doctest::Approx(la::determinant(A)));
+    }
+
+    SUBCASE("exposes triangular factors with PA = LU") {
+        Matrix A = dominant_matrix(5);
+        A(0, 0) = 0.0; // forces a row interchange
+        LU lu(A);
+        REQUIRE_FALSE(lu.is_singular());
+        CHECK(lu.lower().triangle() == la::Triangle::Lower);
+        CHECK(lu.upper().triangle() == la::Triangle::Upper);
+        for (std::size_t i = 0; i < 5; ++i) {
+            CHECK_EQ(lu.lower()(i, i), 1.0);
+        }
+        CHECK(near(permute_rows(A, lu.permutation()),
+                   to_matrix(lu.lower()) * to_matrix(lu.upper())));
+    }
+
+    SUBCASE("singular matrix") {
+        Matrix A(2, 2, {2, 4, 1, 2});
+        LU lu(A);
+        CHECK(lu.is_singular());
+        CHECK_EQ(lu.rcond(), 0.0);
+        CHECK_EQ(lu.determinant(), 0.0);
+        CHECK_THROWS_AS(lu.solve(Vector({1, 1})), std::domain_error);
+    }
+
+    SUBCASE("shape errors") {
+        CHECK_THROWS_AS(LU(Matrix(2, 3)), std::invalid_argument);
+        LU lu(la::identity(2));
+        CHECK_THROWS_AS(lu.solve(Vector({1, 2, 3})), std::invalid_argument);
+        CHECK_THROWS_AS(lu.update(Matrix(2, 1), Matrix(3, 1)),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("LU low-rank updates") {
+    using la::LU;
+    using la::Matrix;
+
+    const std::size_t n = 12;
+    Matrix A = dominant_matrix(n);
+    LU lu(A);
+    la::Workspace ws;
+
+    SUBCASE("rank-one updates are applied as corrections") {
+        for (std::size_t step = 1; step <= 3; ++step) {
+            Matrix u = column(n, step);
+            Matrix v = column(n, step + 3);
+            lu.update(u, v);
+            A = A + u * transpose(v);
+            CHECK_EQ(lu.correction_rank(), step);
+            CHECK(near(lu.matrix(), A));
+
+            Matrix B = column(n, 7);
+            CHECK(near(A * lu.solve(B), B));
+            CHECK_EQ(lu.determinant(),
+                     doctest::Approx(la::determinant(A, ws)));
+        }
+    }
+
+    SUBCASE("accumulated rank past n/4 refactors") {
+        Matrix U(n, std::size_t{4});
+        Matrix V(n, std::size_t{4});
+        for (std::size_t t = 0; t < 4; ++t) {
+            for (std::size_t i = 0; i < n; ++i) {
+                U(i, t) = column(n, t + 1)(i, 0);
+                V(i, t) = column(n, t + 2)(i, 0);
+            }
+        }
+        lu.update(U, V);
+        A = A + U * transpose(V);
+        CHECK_EQ(lu.correction_rank(), 0);
+        Matrix B = column(n, 4);
+        CHECK(near(A * lu.solve(B), B));
+    }
+
+    SUBCASE("workspace solves match the plain ones") {
+        lu.update(column(n, 1), column(n, 2));
+        REQUIRE_EQ(lu.correction_rank(), 1);
+        la::Vector b = column(n, 5).column(0);
+        la::Vector x{9};
+        lu.solve(b, x, ws);
+        CHECK_NEAR(x, lu.solve(b));
+        Matrix B = column(n, 6);
+        Matrix X(1, 1);
+        lu.solve(B, X, ws);
+        CHECK_NEAR(X, lu.solve(B));
+    }
+
+    SUBCASE("update to a singular matrix") {
+        // Replace row 0 by zeros: u = -e_0, v = row 0 of A.
+        Matrix u(n, std::size_t{1});
+        u(0, 0) = -1.0;
+        Matrix v = transpose(A.row_range(0, 1));
+        lu.update(u, v);
+        CHECK(lu.is_singular());
+        CHECK_EQ(lu.determinant(), 0.0);
+
+        // ... and back again.
+        Matrix e(n, std::size_t{1});
+        e(0, 0) = 1.0;
+        lu.update(e, v);
+        CHECK_FALSE(lu.is_singular());
+        Matrix B = column(n, 2);
+        CHECK(near(A * lu.solve(B), B));
+    }
+}
+
+TEST_CASE("LU refactors once the capacitance matrix gets too large") {
+    // For n = 100 the correction buffers hold 25 columns, but a rank-one
+    // update only keeps its O(n^2) cost while K^3 <= n^2, i.e. K <= 21.
+    using la::LU;
+    using la::Matrix;
+
+    const std::size_t n = 100;
+    Matrix A = dominant_matrix(n);
+    LU lu(A);
+    for (std::size_t step = 1; step <= 22; ++step) {
+        Matrix u = column(n, step);
+        Matrix v = column(n, step + 1);
+        lu.update(u, v);
+        A = A + u * transpose(v);
+        CHECK_EQ(lu.correction_rank(), step <= 21 ? step : 0);
+    }
+    Matrix B = column(n, 3);
+    CHECK(near(A * lu.solve(B), B));
+    CHECK(near(lu.matrix(), A));
+}
@@ -284,6 +284,23 @@ TEST_CASE("exchange_rows") {
     // clang-format on
     m.exchange_rows(0, 1);
     CHECK_EQ(m, expected);
+
+    SUBCASE("swapping a row with itself changes nothing") {
+        m.exchange_rows(2, 2);
+        CHECK_EQ(m, expected);
+    }
+
+    SUBCASE("swapping twice restores the matrix") {
+        m.exchange_rows(3, 0);
+        m.exchange_rows(0, 3);
+        CHECK_EQ(m, expected);
+    }
+
+    SUBCASE("out of range index throws") {
+        CHECK_THROWS_AS(m.exchange_rows(0, 4), std::out_of_range);
+        CHECK_THROWS_AS(m.exchange_rows(4, 0), std::out_of_range);
+        CHECK_EQ(m, expected);
+    }
 }
 
 TEST_SUITE("range methods") {
@@ -107,6 +107,33 @@ TEST_CASE("is_in_span") {
     }
 }
 
+TEST_CASE("are_in_span") {
+    using la::Matrix;
+
+    // clang-format off
+    Matrix A(3, 2, {
+       1, -1,
+       0,  1,
+       3, -3
+    });
+    // Columns: in span, not in span, zero vector, first column of A.
+    Matrix B(3, 4, {
+       1, 2, 0, 1,
+       2, 3, 0, 0,
+       3, 4, 0, 3
+    });
+    // clang-format on
+
+    std::vector<bool> expected{true, false, true, true};
+    CHECK_EQ(la::are_in_span(A, B), expected);
+    for (std::size_t j = 0; j < B.cols(); ++j) {
+        CHECK_EQ(la::is_in_span(A, B.column(j)), expected[j]);
+    }
+
+    CHECK(la::are_in_span(A, Matrix(3, 0)).empty());
+    CHECK_THROWS_AS(la::are_in_span(A, Matrix(2, 1)), std::invalid_argument);
+}
+
 TEST_CASE("is_linear_combination") {
     using la::Matrix;
 
@@ -0,0 +1,139 @@
+#include "doctest/doctest.h"
+#include "la/matrix.hpp"
+#include "la/matrix_products.hpp"
+#include "la/matrix_transforms.hpp"
+#include "test_utils.hpp"
+#include <cmath>
+#include <limits>
+
+namespace {
+// Deterministic m x n matrix with a mix of signs and some zeros.
+la::Matrix sample_matrix(std::size_t m, std::size_t n) {
+    la::Matrix A(m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            A(i, j) = static_cast<double>((i * 7 + j * 3) % 11) - 5.0;
+        }
+    }
+    return A;
+}
+} // namespace
+
+TEST_CASE("gram") {
+    using la::Matrix;
+
+    SUBCASE("small matrix") {
+        Matrix A(3, 2, {1, 2, 3, 4, 5, 6});
+        Matrix expected(2, 2, {35, 44, 44, 56});
+        CHECK_EQ(gram(A), expected);
+    }
+
+    SUBCASE("matches transpose product across several blocks") {
+        Matrix A = sample_matrix(70, 130);
+        Matrix G = gram(A);
+        CHECK_NEAR(G, transpose(A) * A);
+        CHECK(is_symmetric(G));
+    }
+
+    SUBCASE("empty matrix") {
+        CHECK_EQ(gram(Matrix(0, 3)), Matrix(3, 3));
+    }
+}
+
+TEST_CASE("outer_gram") {
+    using la::Matrix;
+
+    SUBCASE("small matrix") {
+        Matrix A(2, 3, {1, 2, 3, 4, 5, 6});
+        Matrix expected(2, 2, {14, 32, 32, 77});
+        CHECK_EQ(outer_gram(A), expected);
+    }
+
+    SUBCASE("matches transpose product across several blocks") {
+        Matrix A = sample_matrix(130, 70);
+        CHECK_NEAR(outer_gram(A), A * transpose(A));
+    }
+}
+
+TEST_CASE("multiply with op flags") {
+    using la::Matrix;
+    using la::Op;
+
+    Matrix A = sample_matrix(5, 3);
+    Matrix B = sample_matrix(5, 4);
+    Matrix C = sample_matrix(4, 3);
+    Matrix D = sample_matrix(3, 4);
+    Matrix E = sample_matrix(4, 5);
+
+    SUBCASE("A B matches operator*") {
+        CHECK_EQ(multiply(A, Op::None, D, Op::None), A * D);
+    }
+
+    SUBCASE("A^T B without materialising the transpose") {
+        CHECK_NEAR(multiply(A, Op::Transpose, B, Op::None),
+                   transpose(A) * B);
+    }
+
+    SUBCASE("A B^T without materialising the transpose") {
+        CHECK_NEAR(multiply(A, Op::None, C, Op::Transpose), A * transpose(C));
+    }
+
+    SUBCASE("A^T B^T without materialising either transpose") {
+        CHECK_NEAR(multiply(A, Op::Transpose, E, Op::Transpose),
+                   transpose(A) * transpose(E));
+    }
+
+    SUBCASE("inner dimension mismatch throws") {
+        CHECK_THROWS_AS(multiply(A, Op::None, B, Op::None),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(multiply(A, Op::Transpose, D, Op::None),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("multiply matrix with vector") {
+    using la::Matrix;
+    using la::Op;
+    using la::Vector;
+
+    Matrix A = sample_matrix(4, 3);
+
+    SUBCASE("A x") {
+        Vector x({1, -2, 3});
+        CHECK_EQ(multiply(A, Op::None, x), A * x);
+    }
+
+    SUBCASE("A^T r") {
+        Vector r({1, 0, -1, 2});
+        CHECK_NEAR(multiply(A, Op::Transpose, r), transpose(A) * r);
+    }
+
+    SUBCASE("size mismatch throws") {
+        CHECK_THROWS_AS(multiply(A, Op::Transpose, Vector({1, 2, 3})),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("products propagate NaN and infinity through zero entries") {
+    using la::Matrix;
+    using la::Op;
+
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    // Every non-finite value meets a zero: 0 * inf and 0 * nan are NaN.
+    Matrix Z(2, 2, {0.0, 0.0, 0.0, 0.0});
+    Matrix B(2, 2, {inf, 1.0, 1.0, nan});
+
+    const Matrix products[] = {Z * B, multiply(Z, Op::Transpose, B, Op::None),
+                               multiply(B, Op::None, Z, Op::Transpose),
+                               multiply(B, Op::Transpose, Z, Op::Transpose)};
+    for (const Matrix &C : products) {
+        CHECK(std::isnan(C(0, 0)));
+        CHECK(std::isnan(C(1, 1)));
+    }
+
+    const la::Vector y = multiply(B, Op::Transpose, la::Vector({0.0, 0.0}));
+    CHECK(std::isnan(y[0]));
+    CHECK(std::isnan(y[1]));
+    CHECK(std::isnan(la::gram(Matrix(2, 2, {0.0, inf, 1.0, 0.0}))(0, 1)));
+}
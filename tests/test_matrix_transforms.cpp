@@ -1,6 +1,7 @@
 #include "doctest/doctest.h"
 #include "la/matrix.hpp"
 #include "la/matrix_transforms.hpp"
+#include "test_utils.hpp"
 
 TEST_CASE("transpose") {
     using la::Matrix;
@@ -101,3 +102,155 @@ TEST_CASE("inverse") {
         CHECK(!was_invertible);
     }
 }
+
+namespace {
+la::Matrix numbered_matrix(std::size_t m, std::size_t n) {
+    la::Matrix A(m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            A(i, j) = static_cast<double>(i * n + j);
+        }
+    }
+    return A;
+}
+
+bool is_transpose_of(const la::Matrix &T, const la::Matrix &A) {
+    if (T.rows() != A.cols() || T.cols() != A.rows())
+        return false;
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            if (T(j, i) != A(i, j))
+                return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("blocked transpose") {
+    using la::Matrix;
+
+    SUBCASE("shapes larger than one tile") {
+        Matrix A = numbered_matrix(67, 129);
+        CHECK(is_transpose_of(transpose(A), A));
+    }
+
+    SUBCASE("empty matrix") {
+        Matrix A(0, 3);
+        CHECK_EQ(transpose(A).rows(), 3);
+        CHECK_EQ(transpose(A).cols(), 0);
+    }
+}
+
+TEST_CASE("transpose_inplace") {
+    using la::Matrix;
+
+    SUBCASE("odd-sized square matrix") {
+        Matrix A = numbered_matrix(37, 37);
+        Matrix B = A;
+        transpose_inplace(B);
+        CHECK(is_transpose_of(B, A));
+    }
+
+    SUBCASE("power-of-two square matrix") {
+        Matrix A = numbered_matrix(64, 64);
+        Matrix B = A;
+        transpose_inplace(B);
+        CHECK(is_transpose_of(B, A));
+    }
+
+    SUBCASE("non-square throws") {
+        Matrix A(2, 3);
+        CHECK_THROWS_AS(transpose_inplace(A), std::invalid_argument);
+    }
+}
+
+TEST_CASE("transpose_parallel") {
+    using la::Matrix;
+
+    SUBCASE("large matrix split across threads") {
+        Matrix A = numbered_matrix(300, 257);
+        CHECK(is_transpose_of(transpose_parallel(A, 3), A));
+    }
+
+    SUBCASE("small matrix with default thread count") {
+        Matrix A = numbered_matrix(3, 2);
+        CHECK_EQ(transpose_parallel(A), transpose(A));
+    }
+}
+
+TEST_CASE("inverse_inplace") {
+    using la::Matrix;
+
+    SUBCASE("matches the inverse and needs pivoting") {
+        // clang-format off
+        Matrix A(3, 3, {
+            0, 2, 1,
+            1, 1, 0,
+            3, 0, 1
+        });
+        // clang-format on
+        Matrix B = A;
+        REQUIRE(inverse_inplace(B));
+        CHECK_NEAR(A * B, la::identity(3));
+        CHECK_NEAR(B * A, la::identity(3));
+    }
+
+    SUBCASE("singular matrix returns false") {
+        Matrix A(2, 2, {2, 4, 1, 2});
+        CHECK(!inverse_inplace(A));
+    }
+
+    SUBCASE("non-square throws") {
+        Matrix A(2, 3);
+        CHECK_THROWS_AS(inverse_inplace(A), std::invalid_argument);
+    }
+}
+
+TEST_CASE("update_inverse") {
+    using la::Matrix;
+
+    // clang-format off
+    Matrix A(3, 3, {
+        4, 1, 0,
+        1, 3, 1,
+        0, 1, 2
+    });
+    // clang-format on
+    Matrix Ainv;
+    REQUIRE(inverse(A, Ainv));
+
+    SUBCASE("rank-one change matches inverting the changed matrix") {
+        Matrix u(3, 1, {1, 0, 2});
+        Matrix v(3, 1, {0, 1, 1});
+        REQUIRE(update_inverse(Ainv, u, v));
+        Matrix changed = A + u * transpose(v);
+        CHECK(la::approx_equal(changed * Ainv, la::identity(3), 1e-12,
+                               1e-10));
+    }
+
+    SUBCASE("rank-two change") {
+        Matrix U(3, 2, {1, 0, 0, 1, 1, 1});
+        Matrix V(3, 2, {0, 2, 1, 0, 0, -1});
+        REQUIRE(update_inverse(Ainv, U, V));
+        Matrix changed = A + U * transpose(V);
+        CHECK(la::approx_equal(changed * Ainv, la::identity(3), 1e-12,
+                               1e-10));
+    }
+
+    SUBCASE("change to a singular matrix leaves Ainv alone") {
+        // Subtracting the first row of A from itself zeroes it.
+        Matrix u(3, 1, {-1, 0, 0});
+        Matrix v(3, 1, {4, 1, 0});
+        Matrix before = Ainv;
+        CHECK_FALSE(update_inverse(Ainv, u, v));
+        CHECK_EQ(Ainv, before);
+    }
+
+    SUBCASE("mismatched shapes throw") {
+        CHECK_THROWS_AS(update_inverse(Ainv, Matrix(2, 1), Matrix(3, 1)),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(update_inverse(Ainv, Matrix(3, 1), Matrix(3, 2)),
+                        std::invalid_argument);
+    }
+}
@@ -1,6 +1,8 @@
 #include "doctest/doctest.h"
 #include "la/parity.hpp"
 #include <bitset>
+#include <string>
+#include <vector>
 
 TEST_CASE("1010") {
     using la::has_parity_error;
@@ -195,3 +197,70 @@ TEST_CASE("isbn10_has_error too many digits throws") {
     std::vector<int> v{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}; // should be 10
     CHECK_THROWS_AS(isbn10_has_error(v), std::invalid_argument);
 }
+
+TEST_CASE("upc_find_errors over a text buffer") {
+    const std::string text = "059464700278\n"
+                             "014014184120\n"
+                             "059464700272\n" // check should be 8
+                             "05946470027a\n";
+    la::BitVector failed;
+    CHECK_EQ(2, la::upc_find_errors(text.data(), 4, 13, failed));
+    CHECK_EQ(failed.size(), 4);
+    CHECK(failed == la::BitVector{0, 0, 1, 1});
+
+    std::vector<std::size_t> failures{7};
+    CHECK_EQ(2, la::upc_find_errors(text.data(), 4, 13, failures));
+    CHECK(failures == std::vector<std::size_t>{2, 3});
+
+    CHECK_THROWS_AS(la::upc_find_errors(text.data(), 4, 11, failed),
+                    std::invalid_argument);
+}
+
+TEST_CASE("upc_find_errors agrees with upc_has_error past one word") {
+    // 200 codes back to back, every seventh with a wrong check digit.
+    std::string text;
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < 200; ++i) {
+        std::vector<int> v(11);
+        std::string code;
+        for (std::size_t j = 0; j < 11; ++j) {
+            v[j] = static_cast<int>((i * 7 + j * j) % 10);
+            code += static_cast<char>('0' + v[j]);
+        }
+        int check = la::upc_check_digit(v);
+        if (i % 7 == 3) {
+            check = (check + 1) % 10;
+            expected.push_back(i);
+        }
+        text += code + static_cast<char>('0' + check);
+    }
+    std::vector<std::size_t> failures;
+    CHECK_EQ(expected.size(), la::upc_find_errors(text.data(), 200, 12,
+                                                  failures));
+    CHECK(failures == expected);
+}
+
+TEST_CASE("upc_complete writes check digits in place") {
+    std::string text = "05946470027?,01401418412?,0594647x027?";
+    CHECK_EQ(1, la::upc_complete(&text[0], 3, 13));
+    CHECK_EQ(text, "059464700278,014014184120,0594647x027?");
+}
+
+TEST_CASE("isbn10_find_errors accepts X as check character") {
+    const std::string text = "038797993X 0394756827 0449508356 038797993x";
+    std::vector<std::size_t> failures;
+    CHECK_EQ(1, la::isbn10_find_errors(text.data(), 4, 11, failures));
+    CHECK(failures == std::vector<std::size_t>{2});
+
+    const std::string bad = "X387979930";
+    la::BitVector failed;
+    CHECK_EQ(1, la::isbn10_find_errors(bad.data(), 1, 10, failed));
+    CHECK_THROWS_AS(la::isbn10_find_errors(bad.data(), 1, 9, failed),
+                    std::invalid_argument);
+}
+
+TEST_CASE("isbn10_complete writes digits and X") {
+    std::string text = "038797993-039475682-04495x835-";
+    CHECK_EQ(1, la::isbn10_complete(&text[0], 3, 10));
+    CHECK_EQ(text, "038797993X039475682704495x835-");
+}
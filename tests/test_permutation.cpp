@@ -0,0 +1,119 @@
+#include "doctest/doctest.h"
+#include "la/matrix.hpp"
+#include "la/permutation.hpp"
+#include "la/vector.hpp"
+
+TEST_CASE("Permutation construction") {
+    using la::Permutation;
+
+    SUBCASE("size constructor gives identity") {
+        Permutation p(3);
+        CHECK_EQ(p.size(), 3);
+        CHECK_EQ(p[0], 0);
+        CHECK_EQ(p[1], 1);
+        CHECK_EQ(p[2], 2);
+    }
+
+    SUBCASE("repeated index throws") {
+        CHECK_THROWS_AS(Permutation(std::vector<std::size_t>{0, 1, 1}),
+                        std::invalid_argument);
+    }
+
+    SUBCASE("index out of range throws") {
+        CHECK_THROWS_AS(Permutation(std::vector<std::size_t>{0, 3, 1}),
+                        std::invalid_argument);
+    }
+
+    SUBCASE("inverse maps back") {
+        Permutation p(std::vector<std::size_t>{2, 0, 1});
+        Permutation inv = p.inverse();
+        CHECK_EQ(inv, Permutation(std::vector<std::size_t>{1, 2, 0}));
+        CHECK_EQ(inv.inverse(), p);
+    }
+}
+
+TEST_CASE("Permutation applied to vectors and matrices") {
+    using la::Matrix;
+    using la::Permutation;
+    using la::Vector;
+
+    Permutation p(std::vector<std::size_t>{2, 0, 1});
+
+    SUBCASE("permute and unpermute vector") {
+        Vector v({10, 20, 30});
+        CHECK_EQ(permute(v, p), Vector({30, 10, 20}));
+        CHECK_EQ(unpermute(permute(v, p), p), v);
+    }
+
+    SUBCASE("permute and unpermute rows") {
+        Matrix A(3, 2, {1, 2, 3, 4, 5, 6});
+        Matrix expected(3, 2, {5, 6, 1, 2, 3, 4});
+        CHECK_EQ(permute_rows(A, p), expected);
+        CHECK_EQ(unpermute_rows(permute_rows(A, p), p), A);
+    }
+
+    SUBCASE("permute and unpermute columns") {
+        Matrix A(2, 3, {1, 2, 3, 4, 5, 6});
+        Matrix expected(2, 3, {3, 1, 2, 6, 4, 5});
+        CHECK_EQ(permute_cols(A, p), expected);
+        CHECK_EQ(unpermute_cols(permute_cols(A, p), p), A);
+    }
+
+    SUBCASE("symmetric permutation") {
+        // clang-format off
+        Matrix A(3, 3, {
+            1, 2, 3,
+            4, 5, 6,
+            7, 8, 9
+        });
+        Matrix expected(3, 3, {
+            9, 7, 8,
+            3, 1, 2,
+            6, 4, 5
+        });
+        // clang-format on
+        CHECK_EQ(permute_symmetric(A, p), expected);
+    }
+
+    SUBCASE("size mismatch throws") {
+        CHECK_THROWS_AS(permute(Vector({1, 2}), p), std::invalid_argument);
+        CHECK_THROWS_AS(permute_rows(Matrix(2, 3), p), std::invalid_argument);
+        CHECK_THROWS_AS(permute_cols(Matrix(3, 2), p), std::invalid_argument);
+        CHECK_THROWS_AS(permute_symmetric(Matrix(3, 2), p),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("Permutation swap and sign") {
+    using la::Matrix;
+    using la::Permutation;
+
+    SUBCASE("swap exchanges two entries") {
+        Permutation p(4);
+        p.swap(0, 3);
+        CHECK_EQ(p, Permutation({3, 1, 2, 0}));
+        CHECK_THROWS_AS(p.swap(0, 4), std::out_of_range);
+    }
+
+    SUBCASE("sign counts transpositions") {
+        CHECK_EQ(Permutation(3).sign(), 1);
+        CHECK_EQ(Permutation({1, 0, 2}).sign(), -1);
+        CHECK_EQ(Permutation({2, 0, 1}).sign(), 1);
+        CHECK_EQ(Permutation({1, 0, 3, 2}).sign(), 1);
+        CHECK_EQ(Permutation({3, 0, 1, 2}).sign(), -1);
+    }
+
+    SUBCASE("permute_rows_inplace matches permute_rows") {
+        Matrix A(5, 2, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        for (const Permutation &p :
+             {Permutation(5), Permutation({4, 3, 2, 1, 0}),
+              Permutation({1, 2, 0, 4, 3}), Permutation({3, 0, 4, 1, 2})}) {
+            Matrix B = A;
+            permute_rows_inplace(B, p);
+            CHECK_EQ(B, permute_rows(A, p));
+        }
+        Matrix C(2, 2);
+        CHECK_THROWS_AS(permute_rows_inplace(C, Permutation(3)),
+                        std::invalid_argument);
+    }
+}
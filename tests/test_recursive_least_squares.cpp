@@ -0,0 +1,124 @@
+#include "doctest/doctest.h"
+#include "la/linear_system.hpp"
+#include "la/matrix.hpp"
+#include "la/matrix_transforms.hpp"
+#include "la/recursive_least_squares.hpp"
+#include "la/vector.hpp"
+#include "la/vector_algorithms.hpp"
+#include "test_utils.hpp"
+#include <cmath>
+
+namespace {
+// Least squares through the normal equations A^T A x = A^T b.
+la::Vector normal_solution(const la::Matrix &A, const la::Vector &b) {
+    la::Matrix At = la::transpose(A);
+    return la::solve(At * A, At * b).particular;
+}
+
+bool near(const la::Vector &a, const la::Vector &b) {
+    return la::approx_equal(a, b, 1e-10, 1e-9);
+}
+} // namespace
+
+TEST_CASE("RecursiveLeastSquares fits a line") {
+    using la::Matrix;
+    using la::RecursiveLeastSquares;
+    using la::Vector;
+
+    // y = 1 + 2 t with some noise.
+    // clang-format off
+    Matrix A(5, 2, {
+        1, 0,
+        1, 1,
+        1, 2,
+        1, 3,
+        1, 4
+    });
+    // clang-format on
+    Vector b({1.1, 2.9, 5.2, 6.8, 9.1});
+
+    RecursiveLeastSquares rls(2);
+    CHECK_FALSE(rls.is_full_rank());
+    CHECK_THROWS_AS(rls.solution(), std::domain_error);
+
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        rls.add(A.row(i), b[i]);
+    }
+    CHECK_EQ(rls.observations(), 5);
+    REQUIRE(rls.is_full_rank());
+
+    SUBCASE("solution and residual match the normal equations") {
+        Vector x = rls.solution();
+        CHECK(near(x, normal_solution(A, b)));
+        CHECK_EQ(rls.residual_norm(), doctest::Approx(la::norm(A * x - b)));
+    }
+
+    SUBCASE("sliding window removes the oldest rows") {
+        rls.remove(A.row(0), b[0]);
+        rls.remove(A.row(1), b[1]);
+        CHECK_EQ(rls.observations(), 3);
+
+        Matrix W = A.row_range(2, 5);
+        Vector c({b[2], b[3], b[4]});
+        Vector x = rls.solution();
+        CHECK(near(x, normal_solution(W, c)));
+        CHECK_EQ(rls.residual_norm(), doctest::Approx(la::norm(W * x - c)));
+    }
+
+    SUBCASE("removing too much throws and keeps the fit") {
+        RecursiveLeastSquares two(2);
+        two.add(A.row(0), b[0]);
+        two.add(A.row(1), b[1]);
+        Vector before = two.solution();
+        CHECK_THROWS_AS(two.remove(A.row(0), b[0]), std::domain_error);
+        CHECK(near(two.solution(), before));
+    }
+
+    SUBCASE("clear") {
+        rls.clear();
+        CHECK_EQ(rls.observations(), 0);
+        CHECK_FALSE(rls.is_full_rank());
+    }
+
+    SUBCASE("shape and argument errors") {
+        CHECK_THROWS_AS(rls.add(Vector({1, 2, 3}), 0), std::invalid_argument);
+        CHECK_THROWS_AS(RecursiveLeastSquares(2, 0.0), std::invalid_argument);
+        CHECK_THROWS_AS(RecursiveLeastSquares(2, 1.5), std::invalid_argument);
+    }
+}
+
+TEST_CASE("RecursiveLeastSquares with forgetting") {
+    using la::Matrix;
+    using la::RecursiveLeastSquares;
+    using la::Vector;
+
+    // clang-format off
+    Matrix A(4, 2, {
+        1, 0,
+        1, 1,
+        1, 2,
+        1, 3
+    });
+    // clang-format on
+    Vector b({0, 1, 4, 9});
+    const double lambda = 0.5;
+
+    RecursiveLeastSquares rls(2, lambda);
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        rls.add(A.row(i), b[i]);
+    }
+
+    // Row i carries weight lambda^(3 - i), i.e. sqrt of it on A and b.
+    Matrix W = A;
+    Vector c = b;
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        const double w = std::sqrt(std::pow(lambda, 3.0 - i));
+        for (std::size_t j = 0; j < A.cols(); ++j) {
+            W(i, j) *= w;
+        }
+        c[i] *= w;
+    }
+    Vector x = rls.solution();
+    CHECK(near(x, normal_solution(W, c)));
+    CHECK_EQ(rls.residual_norm(), doctest::Approx(la::norm(W * x - c)));
+}
@@ -0,0 +1,92 @@
+#include "doctest/doctest.h"
+#include "la/linear_system.hpp"
+#include "la/matrix.hpp"
+#include "la/reordering.hpp"
+#include "test_utils.hpp"
+
+namespace {
+// Tridiagonal matrix whose rows and columns have been scrambled by q.
+la::Matrix scrambled_tridiagonal(const la::Permutation &q) {
+    const std::size_t n = q.size();
+    la::Matrix T(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        T(i, i) = 4.0;
+        if (i + 1 < n) {
+            T(i, i + 1) = -1.0;
+            T(i + 1, i) = -1.0;
+        }
+    }
+    return permute_symmetric(T, q);
+}
+} // namespace
+
+TEST_CASE("bandwidth") {
+    using la::Matrix;
+
+    SUBCASE("diagonal matrix has zero bandwidth") {
+        CHECK_EQ(bandwidth(la::identity(3)), 0);
+    }
+
+    SUBCASE("farthest nonzero from diagonal") {
+        // clang-format off
+        Matrix A(4, 4, {
+            1, 1, 0, 0,
+            0, 1, 0, 0,
+            0, 0, 1, 0,
+            2, 0, 0, 1
+        });
+        // clang-format on
+        CHECK_EQ(bandwidth(A), 3);
+    }
+
+    SUBCASE("non-square throws") {
+        CHECK_THROWS_AS(bandwidth(Matrix(2, 3)), std::invalid_argument);
+    }
+}
+
+TEST_CASE("rcm_permutation") {
+    using la::Matrix;
+    using la::Permutation;
+    using la::Vector;
+
+    Permutation q(std::vector<std::size_t>{5, 2, 7, 0, 3, 6, 1, 4});
+    Matrix A = scrambled_tridiagonal(q);
+
+    SUBCASE("recovers the band of a scrambled tridiagonal matrix") {
+        REQUIRE(bandwidth(A) > 1);
+        Permutation p = rcm_permutation(A);
+        CHECK_EQ(bandwidth(permute_symmetric(A, p)), 1);
+    }
+
+    SUBCASE("solution of reordered system maps back") {
+        Vector b({1, 2, 3, 4, 5, 6, 7, 8});
+        Permutation p = rcm_permutation(A);
+
+        auto direct = solve(A, b);
+        auto reordered = solve(permute_symmetric(A, p), permute(b, p));
+        REQUIRE(reordered.is_unique());
+        CHECK_NEAR(unpermute(reordered.particular, p), direct.particular);
+    }
+
+    SUBCASE("disconnected components are all ordered") {
+        // clang-format off
+        Matrix B(4, 4, {
+            1, 0, 1, 0,
+            0, 1, 0, 0,
+            1, 0, 1, 0,
+            0, 0, 0, 1
+        });
+        // clang-format on
+        Permutation p = rcm_permutation(B);
+        CHECK_EQ(p.size(), 4);
+        CHECK_EQ(bandwidth(permute_symmetric(B, p)), 1);
+    }
+
+    SUBCASE("empty matrix gives empty permutation") {
+        CHECK_EQ(rcm_permutation(Matrix(0, 0)).size(), 0);
+    }
+
+    SUBCASE("non-square throws") {
+        CHECK_THROWS_AS(rcm_permutation(Matrix(2, 3)), std::invalid_argument);
+    }
+}
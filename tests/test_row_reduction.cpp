@@ -1,5 +1,6 @@
 #include "doctest/doctest.h"
 #include "la/matrix.hpp"
+#include "la/matrix_linear_systems.hpp"
 #include "la/pivot_policy.hpp"
 #include "la/row_reduction.hpp"
 #include "test_utils.hpp"
@@ -297,3 +298,113 @@ TEST_CASE("rref eliminates using the last pivot row") {
         CHECK(is_zero_pivot(std::fabs(R(1, 2))));
     }
 }
+
+TEST_CASE("ref_inplace and rref_inplace") {
+    using la::Matrix;
+    using la::PivotInfo;
+
+    // clang-format off
+    Matrix A(3, 4, {
+        1, -1, -1, 2,
+        2, -2, -1, 3,
+       -1,  1, -1, 0
+    });
+    // clang-format on
+    const std::vector<std::size_t> pivot_cols{0, 2};
+    const std::vector<std::size_t> free_cols{1, 3};
+
+    SUBCASE("ref_inplace matches ref and reports pivots") {
+        Matrix R = A;
+        PivotInfo info = ref_inplace(R);
+        CHECK_EQ(R, ref(A));
+        CHECK_EQ(info.pivot_cols, pivot_cols);
+        CHECK_EQ(info.free_cols, free_cols);
+    }
+
+    SUBCASE("rref_inplace matches rref and reports pivots") {
+        Matrix R = A;
+        PivotInfo info = rref_inplace(R);
+        CHECK_EQ(R, rref(A));
+        CHECK(is_rref(R));
+        CHECK_EQ(info.pivot_cols, pivot_cols);
+        CHECK_EQ(info.free_cols, free_cols);
+    }
+
+    SUBCASE("zero matrix has only free columns") {
+        Matrix Z(2, 3);
+        PivotInfo info = ref_inplace(Z);
+        CHECK(info.pivot_cols.empty());
+        CHECK_EQ(info.free_cols.size(), 3);
+    }
+}
+
+TEST_CASE("ref and rref with a row permutation") {
+    using la::Matrix;
+    using la::Permutation;
+    using la::PivotInfo;
+
+    // clang-format off
+    Matrix A(4, 3, {
+        0, 0, 1,
+        0, 2, 4,
+        3, 1, 0,
+        6, 2, 5
+    });
+    // clang-format on
+
+    SUBCASE("ref leaves rows in place and matches ref") {
+        Matrix R = A;
+        PivotInfo info;
+        Permutation rows;
+        ref_inplace(R, info, rows);
+        CHECK_NE(rows, Permutation(4)); // the elimination did pivot
+        CHECK_EQ(permute_rows(R, rows), ref(A));
+
+        Matrix B = A;
+        PivotInfo expected = ref_inplace(B);
+        CHECK_EQ(info.pivot_cols, expected.pivot_cols);
+        CHECK_EQ(info.free_cols, expected.free_cols);
+    }
+
+    SUBCASE("rref matches rref after applying the permutation") {
+        Matrix R = A;
+        Permutation rows;
+        PivotInfo info = rref_inplace(R, rows);
+        permute_rows_inplace(R, rows);
+        CHECK_EQ(R, rref(A));
+        CHECK(is_rref(R));
+        CHECK_EQ(info.pivot_cols, std::vector<std::size_t>{0, 1, 2});
+    }
+}
+
+TEST_CASE("ref_inplace carries right-hand sides") {
+    using la::Matrix;
+    using la::PivotInfo;
+
+    // clang-format off
+    Matrix A(3, 3, {
+        0,  2,  3,
+        2,  3,  1,
+        1, -1, -2
+    });
+    Matrix B(3, 2, {
+        8, 1,
+        5, 0,
+       -5, 2
+    });
+    // clang-format on
+
+    Matrix R = A;
+    Matrix X = B;
+    PivotInfo info;
+    ref_inplace(R, X, info);
+
+    Matrix Ab = la::augment(A, B);
+    Matrix expected = la::ref(Ab);
+    CHECK_NEAR(R, expected.col_range(0, 3));
+    CHECK_NEAR(X, expected.col_range(3, 5));
+    CHECK_EQ(info.pivot_cols, std::vector<std::size_t>{0, 1, 2});
+
+    Matrix wrong(2, 1);
+    CHECK_THROWS_AS(ref_inplace(R, wrong, info), std::invalid_argument);
+}
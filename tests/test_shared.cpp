@@ -0,0 +1,91 @@
+#include "doctest/doctest.h"
+#include "la/matrix.hpp"
+#include "la/matrix_linear_systems.hpp"
+#include "la/row_reduction.hpp"
+#include "la/shared.hpp"
+#include "la/vector.hpp"
+
+TEST_CASE("SharedMatrix copy-on-write") {
+    using la::Matrix;
+    using la::SharedMatrix;
+
+    SharedMatrix a(Matrix(2, 2, {1, 2, 3, 4}));
+
+    SUBCASE("copies share the buffer") {
+        SharedMatrix b = a;
+        CHECK(same_buffer(a, b));
+        CHECK(a.is_shared());
+        CHECK_EQ(b.get(), Matrix(2, 2, {1, 2, 3, 4}));
+    }
+
+    SUBCASE("first mutation of a shared copy detaches it") {
+        SharedMatrix b = a;
+        b.mutate()(0, 0) = 10;
+        CHECK(!same_buffer(a, b));
+        CHECK_EQ(a.get()(0, 0), 1);
+        CHECK_EQ(b.get()(0, 0), 10);
+        CHECK(!a.is_shared());
+        CHECK(!b.is_shared());
+    }
+
+    SUBCASE("mutating an unshared handle does not copy") {
+        const Matrix *before = &a.get();
+        a.mutate()(1, 1) = 5;
+        CHECK_EQ(&a.get(), before);
+        CHECK_EQ(a.get()(1, 1), 5);
+    }
+
+    SUBCASE("handles convert to const Matrix& for library calls") {
+        CHECK_EQ(la::rank(a), 2);
+    }
+}
+
+TEST_CASE("SharedVector copy-on-write") {
+    using la::SharedVector;
+    using la::Vector;
+
+    SharedVector a(Vector({1, 2, 3}));
+    SharedVector b = a;
+    b.mutate()[2] = 0;
+    CHECK_EQ(a.get(), Vector({1, 2, 3}));
+    CHECK_EQ(b.get(), Vector({1, 2, 0}));
+    CHECK_EQ(a->size(), 3);
+}
+
+TEST_CASE("are_linearly_independent with shared matrices") {
+    using la::Matrix;
+    using la::SharedMatrix;
+
+    SharedMatrix A(Matrix(2, 2, {1, 0, 0, 0}));
+    SharedMatrix B(Matrix(2, 2, {0, 1, 0, 0}));
+    std::vector<SharedMatrix> independent{A, B};
+    std::vector<SharedMatrix> dependent{A, B, A};
+
+    CHECK(la::are_linearly_independent(independent));
+    CHECK(!la::are_linearly_independent(dependent));
+    CHECK_THROWS_AS(la::are_linearly_independent(std::vector<SharedMatrix>{
+                        A, SharedMatrix(Matrix(1, 2))}),
+                    std::invalid_argument);
+}
+
+TEST_CASE("span and independence checks with shared vectors") {
+    using la::SharedVector;
+    using la::Vector;
+
+    SharedVector u(Vector{1, 0, 1});
+    SharedVector v(Vector{0, 1, 1});
+    std::vector<SharedVector> independent{u, v};
+    std::vector<SharedVector> dependent{u, v, SharedVector(Vector{1, 1, 2})};
+
+    CHECK(la::are_linearly_independent(independent));
+    CHECK(!la::are_linearly_independent(dependent));
+    CHECK(la::are_linearly_independent(std::vector<SharedVector>{}));
+    CHECK(la::is_in_span(independent, Vector{2, 3, 5}));
+    CHECK(!la::is_in_span(independent, Vector{0, 0, 1}));
+
+    std::vector<SharedVector> mixed{u, SharedVector(Vector{1, 0})};
+    CHECK_THROWS_AS(la::are_linearly_independent(mixed),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(la::is_in_span(independent, Vector{1, 2}),
+                    std::invalid_argument);
+}
@@ -0,0 +1,134 @@
+#include "doctest/doctest.h"
+#include "la/eliminated_system.hpp"
+#include "la/linear_system.hpp"
+#include "la/matrix.hpp"
+#include "la/streaming_echelon.hpp"
+#include "la/vector.hpp"
+#include "test_utils.hpp"
+
+namespace {
+void add_rows(la::StreamingEchelon &s, const la::Matrix &A,
+              const la::Vector &b) {
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        s.add_row(A.row(i), b[i]);
+    }
+}
+} // namespace
+
+TEST_CASE("StreamingEchelon tracks rank and pivots") {
+    using la::Matrix;
+    using la::StreamingEchelon;
+    using la::Vector;
+
+    StreamingEchelon s(3);
+    CHECK_EQ(s.rank(), 0);
+    CHECK(s.is_consistent());
+    CHECK_EQ(s.pivots().free_cols, std::vector<std::size_t>{0, 1, 2});
+
+    // The second row brings the leftmost pivot, so it goes first.
+    CHECK(s.add_row(Vector{0, 1, 1}, 2));
+    CHECK(s.add_row(Vector{2, 0, 2}, 4));
+    CHECK_EQ(s.rank(), 2);
+    CHECK_EQ(s.pivots().pivot_cols, std::vector<std::size_t>{0, 1});
+    CHECK_EQ(s.pivots().free_cols, std::vector<std::size_t>{2});
+
+    SUBCASE("rows are kept in RREF") {
+        // clang-format off
+        Matrix expected(2, 4, {
+            1, 0, 1, 2,
+            0, 1, 1, 2
+        });
+        // clang-format on
+        CHECK_NEAR(s.reduced(), expected);
+    }
+
+    SUBCASE("dependent consistent row") {
+        CHECK_FALSE(s.add_row(Vector{2, 1, 3}, 6));
+        CHECK(s.is_consistent());
+        CHECK_EQ(s.rank(), 2);
+        CHECK_EQ(s.rows_seen(), 3);
+    }
+
+    SUBCASE("contradicting row") {
+        CHECK_FALSE(s.add_row(Vector{2, 1, 3}, 7));
+        CHECK_FALSE(s.is_consistent());
+        la::LinearSystemSolution sol = s.solution();
+        CHECK_EQ(sol.kind, la::SolutionKind::None);
+        CHECK(sol.particular.empty());
+        CHECK(sol.directions().empty());
+
+        // Stays inconsistent whatever comes next.
+        CHECK(s.add_row(Vector{0, 0, 1}, 1));
+        CHECK_FALSE(s.is_consistent());
+    }
+
+    SUBCASE("clear starts over") {
+        s.clear();
+        CHECK_EQ(s.rank(), 0);
+        CHECK_EQ(s.rows_seen(), 0);
+        CHECK_EQ(s.pivots().free_cols.size(), 3);
+    }
+
+    SUBCASE("wrong row size throws") {
+        CHECK_THROWS_AS(s.add_row(Vector{1, 2}, 0), std::invalid_argument);
+    }
+}
+
+TEST_CASE("StreamingEchelon agrees with batch elimination") {
+    using la::Matrix;
+    using la::StreamingEchelon;
+    using la::Vector;
+
+    SUBCASE("unique solution") {
+        // clang-format off
+        Matrix A(3, 3, {
+            0,  2,  3,
+            2,  3,  1,
+            1, -1, -2
+        });
+        // clang-format on
+        Vector b({8, 5, -5});
+        StreamingEchelon s(3);
+        add_rows(s, A, b);
+
+        la::LinearSystemSolution sol = s.solution();
+        la::LinearSystemSolution batch = la::solve(A, b);
+        REQUIRE(sol.is_unique());
+        CHECK_NEAR(sol.particular, batch.particular);
+        CHECK_EQ(sol.null_space.rows(), batch.null_space.rows());
+        CHECK_EQ(sol.null_space.cols(), 0);
+        CHECK(sol.directions().empty());
+    }
+
+    SUBCASE("infinite solutions match eliminate_system") {
+        // clang-format off
+        Matrix A(4, 4, {
+            1, 2, 0, 1,
+            2, 4, 1, 3,
+            3, 6, 1, 4,
+            0, 0, 2, 2
+        });
+        // clang-format on
+        Vector b({1, 3, 4, 2});
+        StreamingEchelon s(4);
+        add_rows(s, A, b);
+
+        la::EliminatedSystem es = la::eliminate_system(A, b);
+        CHECK_EQ(s.pivots().pivot_cols, es.pivots.pivot_cols);
+        CHECK_EQ(s.pivots().free_cols, es.pivots.free_cols);
+        CHECK(s.is_consistent());
+
+        la::LinearSystemSolution sol = s.solution();
+        REQUIRE(sol.is_infinite());
+        CHECK_NEAR(A * sol.particular, b);
+        Matrix zero(A.rows(), sol.null_space.cols());
+        CHECK_NEAR(A * sol.null_space, zero);
+
+        std::vector<Vector> directions = sol.directions();
+        REQUIRE_EQ(directions.size(), es.pivots.free_cols.size());
+        for (std::size_t j = 0; j < directions.size(); ++j) {
+            CHECK_EQ(directions[j], sol.null_space.column(j));
+            CHECK_NEAR(A * directions[j], Vector(A.rows()));
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include "doctest/doctest.h"
+#include "la/matrix.hpp"
+#include "la/matrix_transforms.hpp"
+#include "la/symmetric_matrix.hpp"
+#include "la/vector.hpp"
+#include "test_utils.hpp"
+
+TEST_CASE("SymmetricMatrix storage") {
+    using la::Matrix;
+    using la::SymmetricMatrix;
+
+    // clang-format off
+    Matrix A(3, 3, {
+        1, 3, 2,
+        3, 5, 0,
+        2, 0, 4
+    });
+    // clang-format on
+
+    SUBCASE("round trip through full matrix") {
+        SymmetricMatrix S(A);
+        CHECK_EQ(to_matrix(S), A);
+    }
+
+    SUBCASE("both triangles refer to the same element") {
+        SymmetricMatrix S(3);
+        S(2, 0) = 7.0;
+        CHECK_EQ(S(0, 2), 7.0);
+        S.at(0, 1) = -1.0;
+        CHECK_EQ(S(1, 0), -1.0);
+        CHECK_THROWS_AS(S.at(3, 0), std::out_of_range);
+    }
+
+    SUBCASE("non-square throws") {
+        CHECK_THROWS_AS(SymmetricMatrix(Matrix(2, 3)), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Symmetric kernels") {
+    using la::Matrix;
+    using la::SymmetricMatrix;
+    using la::Vector;
+
+    SUBCASE("symv matches full product") {
+        // clang-format off
+        Matrix A(3, 3, {
+            1, 3, 2,
+            3, 5, 0,
+            2, 0, 4
+        });
+        // clang-format on
+        Vector x({1, -1, 2});
+        CHECK_NEAR(symv(SymmetricMatrix(A), x), A * x);
+    }
+
+    SUBCASE("syrk computes A A^T") {
+        Matrix A(2, 3, {1, 2, 3, 4, 5, 6});
+        SymmetricMatrix C = syrk(A);
+        CHECK_EQ(to_matrix(C), A * transpose(A));
+    }
+
+    SUBCASE("size mismatch throws") {
+        CHECK_THROWS_AS(symv(SymmetricMatrix(3), Vector({1, 2})),
+                        std::invalid_argument);
+    }
+}
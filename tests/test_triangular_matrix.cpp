@@ -0,0 +1,108 @@
+#include "doctest/doctest.h"
+#include "la/matrix.hpp"
+#include "la/triangular_matrix.hpp"
+#include "la/vector.hpp"
+#include "test_utils.hpp"
+
+TEST_CASE("TriangularMatrix storage") {
+    using la::Matrix;
+    using la::Triangle;
+    using la::TriangularMatrix;
+
+    // clang-format off
+    Matrix A(3, 3, {
+        1, 2, 3,
+        4, 5, 6,
+        7, 8, 9
+    });
+    Matrix upper(3, 3, {
+        1, 2, 3,
+        0, 5, 6,
+        0, 0, 9
+    });
+    Matrix lower(3, 3, {
+        1, 0, 0,
+        4, 5, 0,
+        7, 8, 9
+    });
+    // clang-format on
+
+    SUBCASE("upper triangle from matrix") {
+        TriangularMatrix U(A, Triangle::Upper);
+        CHECK_EQ(to_matrix(U), upper);
+        CHECK_EQ(U(2, 0), 0.0);
+    }
+
+    SUBCASE("lower triangle from matrix") {
+        TriangularMatrix L(A, Triangle::Lower);
+        CHECK_EQ(to_matrix(L), lower);
+        CHECK_EQ(L(0, 2), 0.0);
+    }
+
+    SUBCASE("at rejects writes outside the triangle") {
+        TriangularMatrix U(3, Triangle::Upper);
+        U.at(0, 2) = 4.0;
+        CHECK_EQ(U(0, 2), 4.0);
+        CHECK_THROWS_AS(U.at(2, 0), std::out_of_range);
+        CHECK_THROWS_AS(U.at(3, 3), std::out_of_range);
+    }
+
+    SUBCASE("leading triangle of an augmented matrix") {
+        Matrix Ub(2, 3, {2, 1, 5, 0, 4, 8});
+        TriangularMatrix U = leading_triangle(Ub, 2, Triangle::Upper);
+        CHECK_EQ(to_matrix(U), Matrix(2, 2, {2, 1, 0, 4}));
+        CHECK_THROWS_AS(leading_triangle(Ub, 3, Triangle::Upper),
+                        std::out_of_range);
+    }
+
+    SUBCASE("non-square throws") {
+        CHECK_THROWS_AS(TriangularMatrix(Matrix(2, 3), Triangle::Upper),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("Triangular kernels") {
+    using la::Matrix;
+    using la::Triangle;
+    using la::TriangularMatrix;
+    using la::Vector;
+
+    // clang-format off
+    Matrix A(3, 3, {
+        2, 1, -1,
+        3, 4,  2,
+        1, 5,  3
+    });
+    // clang-format on
+    TriangularMatrix U(A, Triangle::Upper);
+    TriangularMatrix L(A, Triangle::Lower);
+    Vector x({1, -2, 3});
+
+    SUBCASE("trmv matches full product") {
+        CHECK_NEAR(trmv(U, x), to_matrix(U) * x);
+        CHECK_NEAR(trmv(L, x), to_matrix(L) * x);
+    }
+
+    SUBCASE("trsv inverts trmv") {
+        CHECK_NEAR(trsv(U, trmv(U, x)), x);
+        CHECK_NEAR(trsv(L, trmv(L, x)), x);
+    }
+
+    SUBCASE("trsm solves every column") {
+        Matrix X(3, 2, {1, 4, -2, 0, 3, 1});
+        CHECK_NEAR(trsm(U, to_matrix(U) * X), X);
+        CHECK_NEAR(trsm(L, to_matrix(L) * X), X);
+    }
+
+    SUBCASE("singular triangle throws") {
+        TriangularMatrix S(2, Triangle::Upper, 1.0);
+        S.at(1, 1) = 0.0;
+        CHECK_THROWS_AS(trsv(S, Vector({1, 1})), std::domain_error);
+    }
+
+    SUBCASE("size mismatch throws") {
+        CHECK_THROWS_AS(trmv(U, Vector({1, 2})), std::invalid_argument);
+        CHECK_THROWS_AS(trsv(U, Vector({1, 2})), std::invalid_argument);
+        CHECK_THROWS_AS(trsm(U, Matrix(2, 2)), std::invalid_argument);
+    }
+}
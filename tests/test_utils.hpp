@@ -2,6 +2,9 @@
 #define TEST_UTILS_HPP
 
 #include "la/approx.hpp"
+#include "la/bit_matrix.hpp"
+#include <cstddef>
+#include <cstdint>
 
 constexpr double kTestAbsTol = 1e-12;
 constexpr double kTestRelTol = 1e-10;
@@ -9,4 +12,19 @@ constexpr double kTestRelTol = 1e-10;
 #define CHECK_NEAR(a, b) \
 CHECK(la::approx_equal((a), (b), kTestAbsTol, kTestRelTol))
 
+// Deterministic pseudo-random bits (xorshift64).
+inline la::BitMatrix random_bits(std::size_t rows, std::size_t cols,
+                                 std::uint64_t seed) {
+    la::BitMatrix A(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            A.set(i, j, (seed >> 11) & 1u);
+        }
+    }
+    return A;
+}
+
 #endif // TEST_UTILS_HPP
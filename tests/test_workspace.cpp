@@ -0,0 +1,75 @@
+#include "doctest/doctest.h"
+#include "la/determinant.hpp"
+#include "la/linear_system.hpp"
+#include "la/matrix.hpp"
+#include "la/matrix_transforms.hpp"
+#include "la/row_reduction.hpp"
+#include "la/workspace.hpp"
+#include "test_utils.hpp"
+
+TEST_CASE("determinant with a workspace") {
+    la::Workspace ws;
+
+    SUBCASE("matches the closed forms for small matrices") {
+        la::Matrix A(3, 3, {2, -3, 1, 2, 0, -1, 1, 4, 5});
+        CHECK_EQ(determinant(A, ws), doctest::Approx(determinant(A)));
+        la::Matrix B(2, 2, {1, 2, 3, 4});
+        CHECK_EQ(determinant(B, ws), doctest::Approx(-2));
+    }
+
+    SUBCASE("handles larger matrices") {
+        // clang-format off
+        la::Matrix A(4, 4, {
+                               2, 1, 0, 3,
+                               1, 3, 1, 0,
+                               0, 1, 4, 1,
+                               3, 0, 1, 5
+                           });
+        // clang-format on
+        CHECK_EQ(determinant(A, ws), doctest::Approx(-20));
+    }
+
+    SUBCASE("is zero for a singular matrix") {
+        la::Matrix S(3, 3, {1, 2, 3, 2, 4, 6, 1, 0, 1});
+        CHECK_EQ(determinant(S, ws), 0.0);
+    }
+
+    SUBCASE("throws for a non-square matrix") {
+        CHECK_THROWS_AS(determinant(la::Matrix(2, 3), ws),
+                        std::domain_error);
+    }
+}
+
+TEST_CASE("solve with a workspace matches solve") {
+    la::Workspace ws;
+    la::LinearSystemSolution sol;
+
+    SUBCASE("infinitely many solutions") {
+        la::Matrix A(3, 4, {1, -1, -1, 2, 2, -2, -1, 3, -1, 1, -1, 0});
+        la::Vector b{1, 3, -3};
+        la::solve(A, b, sol, ws);
+        la::LinearSystemSolution expected = la::solve(A, b);
+        CHECK(sol.kind == la::SolutionKind::Infinite);
+        CHECK_NEAR(sol.particular, expected.particular);
+        REQUIRE_EQ(sol.null_space.cols(), expected.null_space.cols());
+        for (std::size_t i = 0; i < sol.null_space.cols(); ++i) {
+            CHECK_NEAR(sol.null_space.column(i), expected.null_space.column(i));
+        }
+    }
+
+    SUBCASE("inconsistent system clears a previous solution") {
+        la::Matrix A(2, 2, {1, 1, 1, 1});
+        la::solve(A, la::Vector{1, 1}, sol, ws);
+        CHECK(sol.kind == la::SolutionKind::Infinite);
+        la::solve(A, la::Vector{1, 2}, sol, ws);
+        CHECK(sol.kind == la::SolutionKind::None);
+        CHECK_EQ(sol.particular.size(), 0);
+        CHECK_EQ(sol.null_space.cols(), 0);
+        CHECK(sol.directions().empty());
+    }
+
+    SUBCASE("throws on size mismatch") {
+        CHECK_THROWS_AS(la::solve(la::Matrix(2, 2), la::Vector(3), sol, ws),
+                        std::invalid_argument);
+    }
+}